@@ -0,0 +1,245 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_bench.c
+  * @brief          : Chrono module benchmarks.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_bench.h"
+#include "..\sched\chrono_sched.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Measures CHRONO_BENCH_ITERATIONS executions of "call_" with the reference clock and keeps the smallest of CHRONO_BENCH_ROUNDS measurements.
+ * 
+ * @note "call_" is expanded inside the loop, so inline functions are measured without a function call.
+ * 
+ */
+#define MEASURE_(best_, call_) \
+  for(uint32_t round_ = 0U; round_ < CHRONO_BENCH_ROUNDS; round_++) { \
+    tick_t startTick_ = fChronoClock_GetTick(refClock); \
+    for(uint32_t i_ = 0U; i_ < CHRONO_BENCH_ITERATIONS; i_++) { \
+      call_; \
+    } \
+    tick_t span_ = fChronoClock_TimeSpanTick(refClock, startTick_, fChronoClock_GetTick(refClock)); \
+    if((round_ == 0U) || (span_ < (best_))) { \
+      (best_) = span_; \
+    } \
+  }
+
+/**
+ * @brief Measures one benchmark case and appends its result after removing the cost of the empty loop.
+ * 
+ */
+#define BENCH_CASE_(name_, call_) \
+  if(count < size) { \
+    tick_t best = (tick_t)0; \
+    MEASURE_(best, call_); \
+    results[count].Name = (name_); \
+    results[count].Calls = CHRONO_BENCH_ITERATIONS; \
+    results[count].Ticks = (best > loopTicks) ? (tick_t)(best - loopTicks) : (tick_t)0; \
+    count++; \
+  }
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief Results of the measured calls are written here, so the compiler can't remove the calls.
+ * 
+ */
+static volatile uint32_t sink;
+
+/**
+ * @brief Jobs of the sparse workload cases. None of them is due while the cases are measured.
+ * 
+ */
+static sChrono jobChrono[CHRONO_BENCH_JOBS];
+static sChronoSchedEntry jobEntry[CHRONO_BENCH_JOBS];
+static sChronoSchedEntry *jobHeap[CHRONO_BENCH_JOBS];
+static sChronoSched jobSched;
+
+/**
+ * @brief Names of the sparse workload cases. They are built at run time with the number of jobs.
+ * 
+ */
+static char pollingName[40];
+static char schedRunName[40];
+
+/* Private function prototypes -----------------------------------------------*/
+static char const * JobsName(char * const name, uint32_t size, char const *prefix);
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Measures the cost of the hot functions of the chrono module.
+ * 
+ * @note The chrono module must be initialized with fChrono_Init() before calling this function.
+ * 
+ * @note The reference clock must be faster than the default clock to give meaningful numbers, e.g., a clock that reads the cycle counter of the CPU.
+ *       Build the benchmark once with and once without CHRONO_INLINE to compare the cost of the inline and out-of-line functions.
+ * 
+ * @param refClock Clock that is used for measuring the cost of the calls
+ * @param results Array that receives the results
+ * @param size Number of elements in the results array
+ * @retval count: Number of results written to the array
+ */
+uint32_t fChrono_Benchmark_Run(sChronoClock const * const refClock, sChronoBenchResult * const results, uint32_t size) {
+
+  uint32_t count = 0U;
+  tick_t loopTicks = (tick_t)0;
+
+  if((refClock == NULL) || (results == NULL)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  MEASURE_(loopTicks, sink = i_);
+
+  sChrono chrono;
+  fChrono_StartTimeoutUs(&chrono, fChrono_GetMaxMeasurableTimeUs());
+
+  sChronoDeadline deadline;
+  fChrono_DeadlineStartUs(&deadline, fChrono_GetMaxMeasurableTimeUs());
+
+  BENCH_CASE_("fChrono_GetTick", sink = (uint32_t)fChrono_GetTick());
+  BENCH_CASE_("fChrono_GetTick64", sink = (uint32_t)fChrono_GetTick64());
+  BENCH_CASE_("fChrono_ElapsedUs", sink = (uint32_t)fChrono_ElapsedUs(&chrono));
+  BENCH_CASE_("fChrono_IsTimeout", sink = (uint32_t)fChrono_IsTimeout(&chrono));
+  BENCH_CASE_("fChrono_DeadlineIsTimeout", sink = (uint32_t)fChrono_DeadlineIsTimeout(&deadline));
+  BENCH_CASE_("fChrono_IntervalUs", sink = (uint32_t)fChrono_IntervalUs(&chrono));
+
+  /* Sparse periodic workload: cost of one pass of the main loop while no job is due. */
+  (void)fChronoSched_Init(&jobSched, fChrono_GetDefaultClock(), jobHeap, CHRONO_BENCH_JOBS);
+  for(uint32_t j = 0U; j < CHRONO_BENCH_JOBS; j++) {
+    fChrono_StartTimeoutUs(&jobChrono[j], fChrono_GetMaxMeasurableTimeUs() - j);
+    (void)fChronoSched_Start(&jobSched, &jobEntry[j], (uint64_t)UINT32_MAX + j, (uint64_t)UINT32_MAX, NULL, NULL);
+  }
+
+  BENCH_CASE_(JobsName(pollingName, sizeof(pollingName), "Polling loop"), for(uint32_t j_ = 0U; j_ < CHRONO_BENCH_JOBS; j_++) { sink = (uint32_t)fChrono_IsTimeout(&jobChrono[j_]); });
+  BENCH_CASE_(JobsName(schedRunName, sizeof(schedRunName), "fChronoSched_Run"), sink = fChronoSched_Run(&jobSched));
+  BENCH_CASE_("fChronoSched_NextDeadlineTicks", sink = (uint32_t)fChronoSched_NextDeadlineTicks(&jobSched));
+
+  return count;
+}
+
+/**
+ * @brief Measures how late fChrono_DelayUs() returns.
+ * 
+ * @note The chrono module must be initialized with fChrono_Init() before calling this function.
+ * 
+ * @note Build the benchmark once with and once without CHRONO_SPIN_HINT() to see the effect of the spin hint and CHRONO_SPIN_BACKOFF_MAX on the accuracy.
+ *       The gain of the hint is on the sibling hyperthread of the core, so measure its throughput at the same time, e.g., with a counting loop pinned to the sibling.
+ * 
+ * @param refClock Clock that is used for measuring the delays
+ * @param delayUs Requested delay of each call (us)
+ * @param result Pointer to the result object
+ * @retval result: FALSE if an argument is NULL, otherwise TRUE.
+ */
+bool_t fChrono_Benchmark_Delay(sChronoClock const * const refClock, timeUs_t delayUs, sChronoBenchDelayResult * const result) {
+
+  int64_t sumLateNs = 0;
+
+  if((refClock == NULL) || (result == NULL)) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  result->DelayUs = delayUs;
+  result->Calls = CHRONO_BENCH_ITERATIONS;
+
+  for(uint32_t i = 0U; i < CHRONO_BENCH_ITERATIONS; i++) {
+    tick_t startTick = fChronoClock_GetTick(refClock);
+    fChrono_DelayUs(delayUs);
+    int64_t lateNs = (int64_t)fChronoClock_TimeSpanNs(refClock, startTick, fChronoClock_GetTick(refClock)) - ((int64_t)delayUs * 1000);
+
+    if((i == 0U) || (lateNs < result->MinLateNs)) {
+      result->MinLateNs = lateNs;
+    }
+    if((i == 0U) || (lateNs > result->MaxLateNs)) {
+      result->MaxLateNs = lateNs;
+    }
+    sumLateNs += lateNs;
+  }
+
+  result->MeanLateNs = sumLateNs / (int64_t)CHRONO_BENCH_ITERATIONS;
+
+  return TRUE;
+}
+
+/**
+ * @brief Returns the build mode of the measured functions.
+ * 
+ * @retval mode: "inline" if CHRONO_INLINE is defined, otherwise "out-of-line".
+ */
+char const * fChrono_Benchmark_GetMode(void) {
+
+#ifdef CHRONO_INLINE
+  return "inline";
+#else
+  return "out-of-line";
+#endif
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Writes the name of a sparse workload case, i.e., the prefix followed by " (CHRONO_BENCH_JOBS jobs)".
+ * 
+ * @param name Buffer that receives the name
+ * @param size Size of the buffer. The name is truncated to fit it.
+ * @param prefix Name of the measured call
+ * @retval name: The buffer
+ */
+static char const * JobsName(char * const name, uint32_t size, char const *prefix) {
+
+  char digits[10];
+  uint32_t count = 0U;
+  uint32_t jobs = CHRONO_BENCH_JOBS;
+  char const *suffix = " jobs)";
+  uint32_t len = 0U;
+
+  do {
+    digits[count++] = (char)('0' + (jobs % 10U));
+    jobs /= 10U;
+  } while(jobs != 0U);
+
+  while((*prefix != '\0') && ((len + 1U) < size)) {
+    name[len++] = *prefix++;
+  }
+  if((len + 2U) < size) {
+    name[len++] = ' ';
+    name[len++] = '(';
+  }
+  while((count != 0U) && ((len + 1U) < size)) {
+    name[len++] = digits[--count];
+  }
+  while((*suffix != '\0') && ((len + 1U) < size)) {
+    name[len++] = *suffix++;
+  }
+  name[len] = '\0';
+
+  return name;
+}
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_bench.h
+  * @brief          : Chrono module benchmark header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FARAABIN_CHRONO_BENCH_H
+#define __FARAABIN_CHRONO_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#include "..\chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Number of calls in one measurement of a benchmark case.
+ * 
+ */
+#ifndef CHRONO_BENCH_ITERATIONS
+#define CHRONO_BENCH_ITERATIONS  (1000U)
+#endif
+
+/**
+ * @brief Number of times each case is measured. The smallest measurement is reported.
+ * 
+ */
+#ifndef CHRONO_BENCH_ROUNDS
+#define CHRONO_BENCH_ROUNDS      (5U)
+#endif
+
+/**
+ * @brief Number of periodic jobs in the sparse workload cases.
+ * 
+ */
+#ifndef CHRONO_BENCH_JOBS
+#define CHRONO_BENCH_JOBS        (16U)
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Result of one benchmark case.
+ * 
+ */
+typedef struct {
+
+  char const *Name;   /*!< Name of the measured call. */
+
+  uint32_t Calls;     /*!< Number of measured calls. */
+
+  tick_t Ticks;       /*!< Total cost of the calls in ticks of the reference clock, after removing the cost of the empty loop. */
+}sChronoBenchResult;
+
+/**
+ * @brief Result of the delay accuracy benchmark.
+ * 
+ */
+typedef struct {
+
+  uint32_t DelayUs;     /*!< Requested delay of each call (us). */
+
+  uint32_t Calls;       /*!< Number of measured delays. */
+
+  int64_t MinLateNs;    /*!< Smallest difference between the measured and the requested delay (ns). Negative if a delay ended early. */
+
+  int64_t MaxLateNs;    /*!< Largest difference between the measured and the requested delay (ns). */
+
+  int64_t MeanLateNs;   /*!< Mean difference between the measured and the requested delay (ns). */
+}sChronoBenchDelayResult;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+uint32_t fChrono_Benchmark_Run(sChronoClock const * const refClock, sChronoBenchResult * const results, uint32_t size);
+bool_t fChrono_Benchmark_Delay(sChronoClock const * const refClock, timeUs_t delayUs, sChronoBenchDelayResult * const result);
+char const * fChrono_Benchmark_GetMode(void);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FARAABIN_CHRONO_BENCH_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -31,10 +31,21 @@
     This address is passed to fChrono_Init() as a pointer to a variable of type tick_t.
     - Alternatively, select TICK_TYPE_FUNCTION if you prefer to obtain the current tick by calling a function.
     In this case, you must provide a function that returns the current tick as tick_t. The address of this function is passed to fChrono_Init().
+    - On a Linux host, select TICK_TYPE_HOST and set CHRONO_TICK_HOST_SOURCE to one of the built-in counters. The counter is read inline,
+    without a pointer or a function call, and fChrono_Init() has no parameter:
+      - TICK_HOST_MONOTONIC_RAW: clock_gettime(CLOCK_MONOTONIC_RAW) in nanoseconds (tick period of 1 ns).
+      - TICK_HOST_MONOTONIC_COARSE: clock_gettime(CLOCK_MONOTONIC_COARSE) in nanoseconds. It is cheaper, but advances once per scheduler tick.
+      - TICK_HOST_RDTSC / TICK_HOST_RDTSCP: the time stamp counter of x86. Set the tick period to the frequency of the invariant TSC.
+      - TICK_HOST_CNTVCT: the virtual counter of the arm64 generic timer (cntvct_el0). Set the tick period to the frequency in cntfrq_el0.
+      - For the cycle counters, fChrono_InitCalibrated() can be called instead of fChrono_Init(). It measures the frequency of the counter,
+        so the tick period in chrono_config.h is only an initial estimate.
+    The host counters are 64-bit. CHRONO_TICK_TOP_VALUE must be 2^n-1 (e.g., 0xFFFFFFFFU for a 32-bit tick_t) and the counter mode must be up.
   
   2- In chrono_config.h file, set the value of CHRONO_TICK_TOP_VALUE. This should be the top value that your tick generator can count upto.
 
   3- In chrono_config.h file, set the value of CHRONO_TICK_TO_NANOSECOND_COEF. This is the amount of time that one tick increment takes.
+    - If the tick period is not an integer number of nanoseconds (e.g., a 24 MHz or 168 MHz counter), define CHRONO_TICK_PERIOD_NUM and
+      CHRONO_TICK_PERIOD_DEN instead. The tick period is then CHRONO_TICK_PERIOD_NUM / CHRONO_TICK_PERIOD_DEN nanoseconds.
 
   4- In chrono_config.h file, set the CHRONO_TICK_COUNTERMODE which is the counting mode of your tick generator.
     - Select TICK_COUNTERMODE_UP if tick generator up counts from zero to CHRONO_TICK_TOP_VALUE.
@@ -51,7 +62,15 @@
   If you have a 16-bit MCU its better to configure chrono with a 16-bit time tick, but keep in mind that maximum measurable time is limited compared to a 32-bit tick.
   Also, a variable of type double has better accuracy for time measurements than a float one.
 
-  6- Initialize the chrono module by calling fChrono_Init(). You need to provide the following parameter:
+  6- Optionally, define CHRONO_INLINE in chrono_config.h file. The hot functions of the objective API (fChrono_GetTick(), fChrono_Start(),
+     fChrono_ElapsedS/Ms/Us/Ns/Tick(), fChrono_IsTimeout(), fChrono_DeadlineIsTimeout() and fChrono_IntervalS/Ms/Us/Ns/Tick()) are then defined as static inline functions in chrono_inline.h.
+     This removes the function call from tight polling loops like WAIT_FOR_WITH_TIMEOUT_US_(). The benchmark in the bench folder shows the difference.
+
+  7- Optionally, define CHRONO_TICK_EXTENSION in chrono_config.h file. The chrono objects then tag the 64-bit tick of the clock instead of the raw tick,
+     so fChrono_ElapsedXX(), fChrono_LeftXX(), fChrono_IsTimeout() and fChrono_IntervalXX() stay valid over any number of overflows of the tick generator.
+     The tick generator must still be observed at least once per period, e.g., by calling fChrono_UpdateTimebase() in its overflow interrupt.
+
+  8- Initialize the chrono module by calling fChrono_Init(). You need to provide the following parameter:
     - Depending on the CHRONO_TICK_TYPE, provide either a pointer to a tick_t variable or a tick_t(*fptr)(void) function pointer
       that returns the current tick for the chrono module.
   
@@ -82,8 +101,16 @@
     - fChrono_ElapsedS()
     - fChrono_ElapsedMs()
     - fChrono_ElapsedUs()
+    - fChrono_ElapsedNs()
+    - fChrono_ElapsedTick()
   - These functions measure the time length between the line of code where fChrono_Start() was called and the line of code where these measurement functions are called.
     They return the time length in their corresponding units.
+  - fChrono_ElapsedNs() and fChrono_ElapsedTick() use 64-bit math and keep the resolution of the tick generator below 1 microsecond.
+    fChrono_ElapsedTick() doesn't convert at all, so for profiling hot paths, collect ticks and convert them only when reporting.
+    The Left, StartTimeout, Interval and TimeSpan functions have the same Ns and Tick variants.
+  - If CHRONO_OVERHEAD_COMPENSATION is defined in chrono_config.h, the init functions measure the ticks that fChrono_Start() followed by
+    fChrono_ElapsedTick() return when nothing runs between them. The elapsed functions subtract them, so short measurements are not biased
+    by the cost of the calls. fChrono_GetElapsedOverheadTick() returns the measured value.
   - Whenever a stop is needed for time measurement, the user can call fChrono_Stop() on the chrono object. This action resets all measurement results and puts the chrono in stop mode.
 
   ### Timeout
@@ -94,11 +121,52 @@
   - To stop the chrono object, call fChrono_Stop(). This action puts the object in the stop state, and checking its timeout state will return FALSE.
   - To determine the remaining time until the chrono times out, use fChrono_LeftS(), fChrono_LeftMs(), or fChrono_LeftUs().
 
+  ### Period
+  - Start a chrono object in timeout mode with the period as the timeout, then poll it with fChrono_IsPeriodDue() instead of fChrono_IsTimeout().
+  - Each due period moves the start tick by exactly one period, so the task keeps its rate even if it is polled late.
+  - If the task misses whole periods, CHRONO_OVERRUN_CATCH_UP runs them back to back, CHRONO_OVERRUN_SKIP drops them and keeps the phase,
+    and CHRONO_OVERRUN_COALESCE drops them and starts the next period from the current tick. The number of missed periods is returned in "missed".
+
+  ### Deadline
+  When many timeouts are polled in a loop, a deadline object can be used instead of a chrono object in timeout mode:
+  - Create a variable of type sChronoDeadline and start it using fChrono_DeadlineStartS(), fChrono_DeadlineStartMs(), fChrono_DeadlineStartUs(),
+    fChrono_DeadlineStartNs() or fChrono_DeadlineStartTicks().
+  - The expiry tick is computed once when the deadline starts, so fChrono_DeadlineIsTimeout() only compares the current tick with the stored ticks.
+    With CHRONO_TICK_EXTENSION, it is a single compare.
+  - fChrono_DeadlineStop() and fChrono_DeadlineLeftS(), fChrono_DeadlineLeftMs(), fChrono_DeadlineLeftUs(), fChrono_DeadlineLeftNs(), fChrono_DeadlineLeftTick()
+    work the same as the functions of the chrono object.
+
+  ### Compact timeout
+  If the application keeps a very large number of timeouts (e.g., one per connection), the size of each object matters:
+  - Create a variable of type sChronoCompact. It has no bool_t fields; its states are kept in the spare bits of a tick field.
+    Without CHRONO_TICK_EXTENSION it holds the start tick and the timeout, with CHRONO_TICK_EXTENSION it only holds the expiry tick.
+  - Use fChrono_CompactStartS/Ms/Us/Ns/Ticks(), fChrono_CompactStop(), fChrono_CompactIsTimeout() and fChrono_CompactLeftS/Ms/Us/Ns/Tick().
+    They behave like the timeout functions of the chrono object.
+  - The longest timeout of a compact object is a quarter of the range of its tick field.
+  - fChrono_GetChronoRamUsage(), fChrono_GetDeadlineRamUsage() and fChrono_GetCompactRamUsage() return the size of one object of each type.
+
   ### Generating time delay
   For creating time delays, there is no need to instantiate a chrono object. Simply call one of the following functions:
   - fChrono_DelayS()
   - fChrono_DelayMs()
   - fChrono_DelayUs()
+  - fChrono_DelayTicks(): The delay is in ticks and it can be longer than the tick range.
+    fChrono_UsToTicks() converts microseconds to the 64-bit number of ticks that it takes.
+
+  The delay functions busy-wait by default. If CHRONO_DELAY_SLEEP is defined in chrono_config.h, they sleep for the bulk of the delay and spin only
+  for the last part of it, which frees the CPU and keeps the precision of the spin:
+  - With TICK_TYPE_HOST, the delay sleeps with clock_nanosleep().
+  - On an MCU, set the sleep function with fChrono_SetDelaySleep(), e.g., a function that enters a low-power wait with __WFI() or __WFE().
+    It may return on any interrupt, the delay sleeps again until the spin window is left.
+  - The spin window follows the measured wake-up latency of the sleep function. fChrono_GetDelaySpinWindowNs() returns its current length.
+
+  The busy-wait loops of the delays and of WAIT_FOR_WITH_TIMEOUT_XX_() read the tick as fast as they can. If CHRONO_SPIN_HINT() is defined,
+  they execute it between two reads, e.g., CHRONO_CPU_RELAX_() ("pause" on x86, "yield" on arm) lets the sibling hyperthread run.
+  With CHRONO_SPIN_BACKOFF_MAX, the number of hints between two reads doubles up to this value, so a long wait reads the timer register less often.
+
+  If CHRONO_OVERHEAD_COMPENSATION is defined, the init functions also measure the fixed cost of a delay call, i.e., the call, the assertions,
+  the conversion of the delay to ticks and the tick reads. It is subtracted from every delay, so short delays don't overshoot by this cost.
+  fChrono_GetDelayOverheadTick() returns the measured value.
 
   ### Measuring time intervals
   To measure time intervals:
@@ -118,6 +186,26 @@
     - fChrono_TimeSpanUs()
   - If the tick generator experiences an overflow (just once), these functions will handle it and return the correct result.
   - However, if the tick generator has overflowed more than once, the time span measurement is no longer valid.
+  - fChrono_GetTick64() returns the tick extended to 64 bits, which doesn't overflow. The module counts the overflows every time it reads the tick,
+    so it must read the tick at least once per period of the tick generator. If the application may not do so, call fChrono_UpdateTimebase()
+    in the overflow interrupt of the tick generator.
+
+  ### Multiple clock domains
+  The functions above work on the default clock, which is configured in chrono_config.h and initialized with fChrono_Init().
+  If the application needs more tick generators at the same time (e.g., a coarse millisecond tick and a fine cycle counter):
+  - Create a variable of type sChronoClock for each tick generator.
+  - Fill a sChronoClockConfig with the tick source, top value, tick period and counting mode of that generator and call fChronoClock_Init().
+  - Use the fChronoClock_xxx() functions. They are the same as the fChrono_xxx() functions, but take the clock as their first argument.
+  - A sChrono object must always be used with the same clock that started it.
+  - fChrono_GetDefaultClock() returns the default clock, so it can be passed to the code that works with sChronoClock.
+
+  ### Calibration
+  If the frequency of a tick generator is not known exactly (e.g., a cycle counter or an RC oscillator), it can be measured at init:
+  - Initialize a reference clock with a known frequency, e.g., a crystal based timer, and the clock that must be calibrated.
+  - Call fChronoClock_Calibrate(), or fChrono_Calibrate() for the default clock. The function busy-waits for the measurement window,
+    measures the frequency of the clock against the reference and sets the tick period of the clock to it.
+  - The sChronoCalibration result holds the frequency and an estimate of its error in ppm. A longer window gives a smaller error.
+  - On a Linux host with a cycle counter tick source, fChrono_InitCalibrated() does the same against CLOCK_MONOTONIC.
 
   ******************************************************************************
   Below is an example of how you can use the chrono module API for a generic application.
@@ -181,61 +269,111 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <float.h>
+
 #include "chrono.h"
+#include "chrono_inline.h"
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST) && (CHRONO_TICK_HOST_SOURCE != TICK_HOST_MONOTONIC_RAW) && (CHRONO_TICK_HOST_SOURCE != TICK_HOST_MONOTONIC_COARSE)
+  #define HOST_CALIBRATION_
+  #include <time.h>
+  #if !defined(CLOCK_MONOTONIC)
+    #error "fChrono_InitCalibrated() needs clock_gettime(). Compile with _GNU_SOURCE or _POSIX_C_SOURCE defined."
+  #endif
+#endif
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST) && defined(CHRONO_DELAY_SLEEP)
+  #define HOST_DELAY_SLEEP_
+  #include <time.h>
+  #if !defined(CLOCK_MONOTONIC) || !defined(TIMER_ABSTIME)
+    #error "CHRONO_DELAY_SLEEP needs clock_nanosleep() with TICK_TYPE_HOST. Compile with _GNU_SOURCE or _POSIX_C_SOURCE defined."
+  #endif
+#endif
 
 /* Private define ------------------------------------------------------------*/
-/* Private macro -------------------------------------------------------------*/
 /**
- * @brief Returns the time length between "a" and "b".
+ * @brief Tick period in nanoseconds as a ratio.
  * 
- * @note Chronologically, "a" must be a time tick after "b", but the value of "a" could be less than "b" i.e., when tick overflows.
+ * @note If the user doesn't define CHRONO_TICK_PERIOD_NUM and CHRONO_TICK_PERIOD_DEN, the period is CHRONO_TICK_TO_NANOSECOND_COEF / 1.
  * 
  */
-#if(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_UP)
-#define ELAPSED_(a, b)  (((a) >= (b)) ? ((a) - (b)) : ((_chrono.TickTopValue) - ((b) - (a))))
-#elif(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_DOWN)
-#define ELAPSED_(a, b)  (((a) <= (b)) ? ((b) - (a)) : ((_chrono.TickTopValue) - ((a) - (b))))
+#if defined(CHRONO_TICK_PERIOD_NUM) && defined(CHRONO_TICK_PERIOD_DEN)
+  #define TICK_PERIOD_NUM_  (CHRONO_TICK_PERIOD_NUM)
+  #define TICK_PERIOD_DEN_  (CHRONO_TICK_PERIOD_DEN)
+#elif defined(CHRONO_TICK_PERIOD_NUM) || defined(CHRONO_TICK_PERIOD_DEN)
+  #error "CHRONO_TICK_PERIOD_NUM and CHRONO_TICK_PERIOD_DEN must be defined together in chrono_config.h file."
 #else
+  #define TICK_PERIOD_NUM_  (CHRONO_TICK_TO_NANOSECOND_COEF)
+  #define TICK_PERIOD_DEN_  (1U)
+#endif
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+  #if ((CHRONO_TICK_TOP_VALUE) & ((CHRONO_TICK_TOP_VALUE) + 1U)) != 0U
+    #error "CHRONO_TICK_TOP_VALUE must be 2^n-1 when CHRONO_TICK_TYPE is TICK_TYPE_HOST."
+  #endif
+  #if (CHRONO_TICK_COUNTERMODE != TICK_COUNTERMODE_UP)
+    #error "CHRONO_TICK_COUNTERMODE must be TICK_COUNTERMODE_UP when CHRONO_TICK_TYPE is TICK_TYPE_HOST."
+  #endif
+  #if ((CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_RAW) || (CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_COARSE)) && (TICK_PERIOD_NUM_ != TICK_PERIOD_DEN_)
+    #error "The tick period of the clock_gettime() tick sources is 1 ns."
+  #endif
+#endif
+
+#if((CHRONO_TICK_COUNTERMODE != TICK_COUNTERMODE_UP) && (CHRONO_TICK_COUNTERMODE != TICK_COUNTERMODE_DOWN))
 #error "CHRONO_TICK_COUNTERMODE should be either TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN in chrono_config.h file."
 #endif
 
+#if defined(CHRONO_SPIN_HINT) && (((CHRONO_SPIN_BACKOFF_MAX) == 0U) || (((CHRONO_SPIN_BACKOFF_MAX) & ((CHRONO_SPIN_BACKOFF_MAX) - 1U)) != 0U))
+#error "CHRONO_SPIN_BACKOFF_MAX must be a power of two in chrono_config.h file."
+#endif
+
 /**
- * @brief Define GET_TICK_() macro for internal use.
+ * @brief Longest measurement window of the calibration in nanoseconds. It keeps the 64-bit products of the frequency computation from overflowing.
  * 
  */
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-  #define GET_TICK_() (*_chrono.pTickValue)
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-  #define GET_TICK_() (_chrono.GetTickValue())
-#else
-  #define GET_TICK_() (tick_t)0;
+#define CALIBRATION_MAX_WINDOW_NS_  (4000000000ULL)
+
+/**
+ * @brief Initial and longest spin window of the delays in nanoseconds, if they are not defined in chrono_config.h.
+ * 
+ */
+#ifndef CHRONO_DELAY_SPIN_NS
+  #define CHRONO_DELAY_SPIN_NS      (50000U)
+#endif
+
+#ifndef CHRONO_DELAY_SPIN_MAX_NS
+  #define CHRONO_DELAY_SPIN_MAX_NS  (1000000U)
 #endif
 
 /**
- * @brief Define START_() macro for internal use.
+ * @brief Shortest spin window of the delays in nanoseconds. The last part of a delay is always spun, so a tick read or two don't make it late.
  * 
  */
-#define START_(chrono_) \
-  (chrono_)->_startTick = GET_TICK_();\
-  (chrono_)->_run = TRUE
+#define DELAY_SPIN_MIN_NS_  (1000U)
 
 /**
- * @brief Define DELAY_TICK_() macro for internal use.
+ * @brief Number of runs of the overhead measurement. The shortest run is kept, so a preemption during one run doesn't matter.
  * 
  */
-#define DELAY_TICK_(startTick_, delayTick_) \
-  tick_t currentTick = GET_TICK_(); \
-  while(ELAPSED_(currentTick, (startTick_)) < (delayTick_)) { \
-    currentTick = GET_TICK_(); \
-  }
+#define OVERHEAD_RUNS_  (16U)
 
-  /**
-   * @brief Define TIMESPAN_() macro for internal use.
-   * 
-   */
-#define TIMESPAN_S_(startTick_, endTick_) ((timeS_t)(ELAPSED_((endTick_), (startTick_))) / _chrono.SecToTickCoef)
-#define TIMESPAN_MS_(startTick_, endTick_) ((timeMs_t)(ELAPSED_((endTick_), (startTick_))) / _chrono.MsToTickCoef)
-#define TIMESPAN_US_(startTick_, endTick_) ((timeUs_t)(ELAPSED_((endTick_), (startTick_))) / _chrono.UsToTickCoef)
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Converts a time length in the specified type to ticks using the precomputed scale of that time unit (see CHRONO_TIME_TO_TICK_()).
+ * 
+ */
+#define S_TO_TICK_(clock_, time_)  CHRONO_TIME_TO_TICK_(timeS_t, (time_), (clock_)->_sToTick)
+#define MS_TO_TICK_(clock_, time_) CHRONO_TIME_TO_TICK_(timeMs_t, (time_), (clock_)->_msToTick)
+#define US_TO_TICK_(clock_, time_) CHRONO_TIME_TO_TICK_(timeUs_t, (time_), (clock_)->_usToTick)
+#define NS_TO_TICK_(clock_, time_) ((chronoTick_t)ChronoScaleApply(&(clock_)->_nsToTick, (time_)))
+
+/**
+ * @brief Returns the remaining time until timeout in the specified type.
+ * 
+ */
+#define LEFT_S_(clock_, timeout_, elapsedTick_)  (CHRONO_TICK_TO_S_((clock_), (timeout_)) - CHRONO_TICK_TO_S_((clock_), (elapsedTick_)))
+#define LEFT_MS_(clock_, timeout_, elapsedTick_) (CHRONO_TICK_TO_MS_((clock_), (timeout_)) - CHRONO_TICK_TO_MS_((clock_), (elapsedTick_)))
+#define LEFT_US_(clock_, timeout_, elapsedTick_) (CHRONO_TICK_TO_US_((clock_), (timeout_)) - CHRONO_TICK_TO_US_((clock_), (elapsedTick_)))
 
 /**
  * @brief Define assert macros.
@@ -252,72 +390,83 @@
 #define ASSERT_NOT_NULL_(pointer_) ASSERT_((pointer_) != NULL)
 #define ASSERT_NOT_NULL_RETURN_(pointer_, return_) ASSERT_RETURN_((pointer_) != NULL, (return_))
 
-/* Private typedef -----------------------------------------------------------*/
-typedef struct {
-
-	bool_t Init;
-	
-	bool_t InitUs;
-	
-	bool_t InitMs;
-	
-	bool_t InitSec;
-
-	uint32_t TickToNsCoef; // Multiplier that converts ticks to nanosecond.
-
-	uint32_t UsToTickCoef; // Multiplier that converts microseconds to ticks.
-
-	uint32_t MsToTickCoef; // Multiplier that converts milliseconds to ticks.
-
-	uint32_t SecToTickCoef; // Multiplier that converts seconds to ticks.
-
-	tick_t TickTopValue; // The tick top value. This private value is set by calling fChrono_Init().
-
-	tick_t TickInitValue; // The tick init value. This private value is tick value when calling fChrono_Init().
-
-	sChrono ChronoTickUs; // **chrono** object that holds the tick value in microseconds since initializing the module using fChrono_Init().
-
-	sChrono ChronoTickMs; // **chrono** object that holds the tick value in milliseconds since initializing the module using fChrono_Init().
+#define ASSERT_CLOCK_(clock_) \
+  ASSERT_NOT_NULL_(clock_); \
+  ASSERT_((clock_)->_init)
 
-	sChrono ChronoTickS; // **chrono** object that holds the tick value in seconds since initializing the module using fChrono_Init().
+#define ASSERT_CLOCK_RETURN_(clock_, return_) \
+  ASSERT_NOT_NULL_RETURN_((clock_), (return_)); \
+  ASSERT_RETURN_((clock_)->_init, (return_))
 
-	uint64_t ContinuousTickUs; // Time length in microseconds since initializing the chrono module.
-
-	uint64_t ContinuousTickMs; // Time length in milliseconds since initializing the chrono module.
-
-	uint64_t ContinuousTickS; // Time length in seconds since initializing the chrono module.
-
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-
-	volatile tick_t *pTickValue; // Pointer to an unsigned integer that hold current value of the tick.
-
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-
-	tick_t(*GetTickValue)(void); // Function pointer to a function that returns current value of the tick.
+/* Private typedef -----------------------------------------------------------*/
 
+/* Private variables ---------------------------------------------------------*/
+#ifdef CHRONO_DELAY_SLEEP
+/**
+ * @brief Function that the delays call to sleep. With TICK_TYPE_HOST it is clock_nanosleep(), otherwise it is set by fChrono_SetDelaySleep().
+ * 
+ */
+#ifdef HOST_DELAY_SLEEP_
+static void HostSleep(uint64_t sleepNs);
+static fpSleep_t _delaySleep = HostSleep;
+#else
+static fpSleep_t _delaySleep = NULL;
 #endif
 
-}sChronoInternal;
+/**
+ * @brief Length of the last part of a delay that is spun instead of slept, in nanoseconds. It follows the wake-up latency of _delaySleep.
+ * 
+ * @note Concurrent delays may update it at the same time. An update can be lost, but the value is always one of the written ones.
+ * 
+ */
+static volatile uint32_t _delaySpinWindowNs = CHRONO_DELAY_SPIN_NS;
+#endif
 
-/* Private variables ---------------------------------------------------------*/
-static sChronoInternal _chrono = {
-	
-	.Init = FALSE,
-	.InitUs = FALSE,
-	.InitMs = FALSE,
-	.InitSec = FALSE,
-	.TickToNsCoef = 1U,
-	.UsToTickCoef = 1U,
-	.MsToTickCoef = 1U,
-	.SecToTickCoef = 1U,
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-	.pTickValue = NULL,
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-	.GetTickValue = NULL
+/**
+ * @brief The default clock. It is configured in chrono_config.h and initialized by fChrono_Init().
+ * 
+ * @note In CHRONO_INLINE mode the inline functions in chrono_inline.h read this object directly, so it has external linkage.
+ * 
+ */
+#ifndef CHRONO_INLINE
+static
 #endif
+sChronoClock _chrono = {
+
+	._init = FALSE,
+	._tickType = CHRONO_TICK_TYPE,
+	._counterMode = CHRONO_DEFAULT_COUNTERMODE_,
+	._tickToNsCoef = 1U,
+	._tickPeriodNum = 1U,
+	._tickPeriodDen = 1U,
+	._pTickValue = NULL,
+	._getTickValue = NULL
 };
 
 /* Private function prototypes -----------------------------------------------*/
+static uint8_t InitDefault(sChronoClockConfig const * const config);
+static uint8_t ClockInit(sChronoClock * const clock, sChronoClockConfig const * const config);
+static bool_t InitScales(sChronoClock * const clock);
+static bool_t ScaleInit(sChronoScale * const me, uint64_t num, uint64_t den);
+static inline void ScaleRatioInit(sChronoScale * const me, bool_t isFloat, bool_t isToTick);
+static void TimebaseInit(sChronoClock * const clock);
+static chrono_res_t ClockCalibrate(sChronoClock * const clock, sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result);
+static uint64_t CalibrationEdge(sChronoClock const * const clock, sChronoClock const * const reference, uint64_t referenceTick, uint64_t * const edgeTick, uint64_t * const width);
+static uint64_t Gcd(uint64_t a, uint64_t b);
+static uint64_t MulDivRound(uint64_t a, uint64_t b, uint64_t c);
+static inline void DelayTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, chronoTick_t startTick, chronoTick_t delayTick);
+static void DelayTicks(sChronoClock const * const clock, uint8_t type, uint8_t mode, uint64_t delayTick);
+#ifdef CHRONO_DELAY_SLEEP
+static void DelaySleep(sChronoClock const * const clock, uint8_t type, uint8_t mode, chronoTick_t startTick, chronoTick_t delayTick);
+static void DelaySpinWindowUpdate(uint64_t latencyNs);
+#endif
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+static void OverheadInit(sChronoClock * const clock);
+#endif
+#ifdef HOST_CALIBRATION_
+static tick_t HostReferenceTick(void);
+#endif
+
 /* Variables -----------------------------------------------------------------*/
 
 /*
@@ -338,7 +487,7 @@ static sChronoInternal _chrono = {
  * @attention This function must be called before using any other function in this library.
  * 
  * @note This function is only available when CHRONO_TICK_TYPE is TICK_TYPE_VARIABLE.
- *
+ * 
  * @note When configuring the chrono module with the TICK_TYPE_VARIABLE, the module fetches the current tick from the tick generator by dereferencing
  *       a memory address as tick_t. The pointer to this memory location is provided by the user via the tickValue argument.
  *       A practical use case for this configuration is when you have a spare timer available. You can start this timer in free run mode,
@@ -349,48 +498,17 @@ static sChronoInternal _chrono = {
  * @retval initStatus: returns 0 if successful and 1 if it fails.
  */
 uint8_t fChrono_Init(volatile tick_t *tickValue) {
-  
-  _chrono.Init = FALSE;
-  _chrono.InitUs = FALSE;
-  _chrono.InitMs = FALSE;
-  _chrono.InitSec = FALSE;
 
-  if(CHRONO_TICK_TOP_VALUE == 0U) {
-    return CHRONO_ERROR_TICK_TOP_ZERO;      /* MISRA 2012 Rule 15.5 deviation */
-  }
-
-  if(CHRONO_TICK_TO_NANOSECOND_COEF == 0U) {
-    return CHRONO_ERROR_TICK_TO_NS_ZERO;    /* MISRA 2012 Rule 15.5 deviation */
-  }
-  
-  if(tickValue == NULL) {
-    return CHRONO_ERROR_TICK_PTR_ERROR;     /* MISRA 2012 Rule 15.5 deviation */
-  }
-  
-  _chrono.TickTopValue = CHRONO_TICK_TOP_VALUE;
-  _chrono.TickToNsCoef = CHRONO_TICK_TO_NANOSECOND_COEF;
-  _chrono.pTickValue = tickValue;
-
-  _chrono.UsToTickCoef = (1000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.MsToTickCoef = (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.SecToTickCoef = (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  
-  _chrono.ContinuousTickUs = 0U;
-	_chrono.ContinuousTickMs = 0U;
-	_chrono.ContinuousTickS = 0U;
-	
-  _chrono.Init = TRUE;
-  _chrono.InitUs = (_chrono.UsToTickCoef != 0U);
-  _chrono.InitMs = (_chrono.MsToTickCoef != 0U);
-  _chrono.InitSec = (_chrono.SecToTickCoef != 0U);
-  
-	START_(&_chrono.ChronoTickUs);
-	START_(&_chrono.ChronoTickMs);
-	START_(&_chrono.ChronoTickS);
+  sChronoClockConfig config = {
+    .TickValue = tickValue,
+    .GetTickValue = NULL,
+    .TickTopValue = CHRONO_TICK_TOP_VALUE,
+    .TickPeriodNum = TICK_PERIOD_NUM_,
+    .TickPeriodDen = TICK_PERIOD_DEN_,
+    .CounterMode = CHRONO_TICK_COUNTERMODE
+  };
 
-  _chrono.TickInitValue = GET_TICK_();
-
-  return CHRONO_OK;
+  return InitDefault(&config);
 }
 #elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
 
@@ -400,7 +518,7 @@ uint8_t fChrono_Init(volatile tick_t *tickValue) {
  * @attention This function must be called before using any other function in this library.
  * 
  * @note This function is only available when CHRONO_TICK_TYPE is TICK_TYPE_FUNCTION.
- *
+ * 
  * @note When configuring the chrono module in this manner, the module always invokes a function that returns the current tick as tick_t.
  *       The user provides a pointer to this function as an input argument when calling fChrono_Init(). This approach allows the chrono module to dynamically fetch the current tick value from the user-defined function,
  *       ensuring accurate and efficient timekeeping. Whether you're using a timer or a custom tick generator, this flexibility enables precise time measurements in your embedded system.
@@ -410,47 +528,157 @@ uint8_t fChrono_Init(volatile tick_t *tickValue) {
  */
 uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
 
-  _chrono.Init = FALSE;
-  _chrono.InitUs = FALSE;
-  _chrono.InitMs = FALSE;
-  _chrono.InitSec = FALSE;
+  sChronoClockConfig config = {
+    .TickValue = NULL,
+    .GetTickValue = fpTickValue,
+    .TickTopValue = CHRONO_TICK_TOP_VALUE,
+    .TickPeriodNum = TICK_PERIOD_NUM_,
+    .TickPeriodDen = TICK_PERIOD_DEN_,
+    .CounterMode = CHRONO_TICK_COUNTERMODE
+  };
+
+  return InitDefault(&config);
+}
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+
+/**
+ * @brief Initializes chrono module in HOST mode based on specified parameters.
+ * 
+ * @attention This function must be called before using any other function in this library.
+ * 
+ * @note This function is only available when CHRONO_TICK_TYPE is TICK_TYPE_HOST.
+ * 
+ * @note The tick is read from the host counter that is selected by CHRONO_TICK_HOST_SOURCE in chrono_config.h. The read is inlined in the
+ *       functions of the default clock, so it costs the same as dereferencing the counter register in TICK_TYPE_VARIABLE mode.
+ * 
+ * @retval initStatus: returns 0 if successful and 1 if it fails.
+ */
+uint8_t fChrono_Init(void) {
+
+  sChronoClockConfig config = {
+    .TickValue = NULL,
+    .GetTickValue = fChrono_GetHostTick,
+    .TickTopValue = CHRONO_TICK_TOP_VALUE,
+    .TickPeriodNum = TICK_PERIOD_NUM_,
+    .TickPeriodDen = TICK_PERIOD_DEN_,
+    .CounterMode = CHRONO_TICK_COUNTERMODE
+  };
+
+  return InitDefault(&config);
+}
+#endif
+
+/**
+ * @brief Initializes a clock with its own tick generator.
+ * 
+ * @note Each clock has its own tick source, top value, tick period and counting mode. The clock doesn't depend on chrono_config.h and on fChrono_Init(),
+ *       so an application can use several tick generators side by side, e.g., a coarse millisecond tick and a fine cycle counter.
+ * 
+ * @note If both config->TickValue and config->GetTickValue are set, the clock reads the tick from config->TickValue.
+ * 
+ * @param clock Pointer to the clock object
+ * @param config Pointer to the configuration of the clock. It is only used during initialization.
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChronoClock_Init(sChronoClock * const clock, sChronoClockConfig const * const config) {
 
-  if(CHRONO_TICK_TOP_VALUE == 0U) {
-    return CHRONO_ERROR_TICK_TOP_ZERO; /* MISRA 2012 Rule 15.5 deviation */
+  if((clock == NULL) || (config == NULL)) {
+    return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
   }
 
-  if(CHRONO_TICK_TO_NANOSECOND_COEF == 0U) {
-    return CHRONO_ERROR_TICK_TO_NS_ZERO; /* MISRA 2012 Rule 15.5 deviation */
+  chrono_res_t res = ClockInit(clock, config);
+
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+  if(res == CHRONO_OK) {
+    OverheadInit(clock);
   }
-  
-  if(fpTickValue == NULL) {
+#endif
+
+  return res;
+}
+
+/**
+ * @brief Measures the frequency of the tick generator of the default clock against a reference clock and sets the tick period of the default clock to it.
+ * 
+ * @note See fChronoClock_Calibrate(). The tick period of chrono_config.h is then only the initial estimate of the period.
+ *       chrono_clock.hpp still uses the tick period of chrono_config.h, because its period is a compile-time constant.
+ * 
+ * @param reference Pointer to the reference clock
+ * @param windowNs Length of the measurement window in nanoseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval calibrationStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChrono_Calibrate(sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result) {
+
+  if((reference == NULL) || !reference->_init || !_chrono._init) {
     return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
   }
-  
-  _chrono.TickTopValue = CHRONO_TICK_TOP_VALUE;
-  _chrono.TickToNsCoef = CHRONO_TICK_TO_NANOSECOND_COEF;
-  _chrono.GetTickValue = fpTickValue;
-
-  _chrono.UsToTickCoef = (1000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.MsToTickCoef = (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.SecToTickCoef = (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-
-  _chrono.ContinuousTickUs = 0U;
-	_chrono.ContinuousTickMs = 0U;
-	_chrono.ContinuousTickS = 0U;
-	
-  _chrono.Init = TRUE;
-  _chrono.InitUs = (_chrono.UsToTickCoef != 0U);
-  _chrono.InitMs = (_chrono.MsToTickCoef != 0U);
-  _chrono.InitSec = (_chrono.SecToTickCoef != 0U);
-  
-	START_(&_chrono.ChronoTickUs);
-	START_(&_chrono.ChronoTickMs);
-	START_(&_chrono.ChronoTickS);
 
-  _chrono.TickInitValue = GET_TICK_();
+  return ClockCalibrate(&_chrono, reference, windowNs, result);
+}
 
-  return CHRONO_OK;
+/**
+ * @brief Measures the frequency of the tick generator of a clock against a reference clock and sets the tick period of the clock to it.
+ * 
+ * @note The function busy-waits for the measurement window, which is aligned to the edges of the reference clock. The reference can be
+ *       much coarser than the clock, e.g., a 1 ms system tick for a cycle counter: a longer window gives a smaller error.
+ *       The error estimate of the result shows whether the window was long enough.
+ * 
+ * @note The scales of the clock are recomputed, so call this function before the clock is used, e.g., right after fChronoClock_Init().
+ *       Both clocks must have a tick period that can be converted to nanoseconds (see fChronoClock_Init()). The window is limited to 4 seconds.
+ * 
+ * @param clock Pointer to the clock object that is calibrated
+ * @param reference Pointer to the reference clock
+ * @param windowNs Length of the measurement window in nanoseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval calibrationStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChronoClock_Calibrate(sChronoClock * const clock, sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result) {
+
+  if((clock == NULL) || (reference == NULL) || !clock->_init || !reference->_init) {
+    return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return ClockCalibrate(clock, reference, windowNs, result);
+}
+
+#ifdef HOST_CALIBRATION_
+/**
+ * @brief Initializes chrono module in HOST mode and calibrates the frequency of the host cycle counter against CLOCK_MONOTONIC.
+ * 
+ * @note This function is only available when CHRONO_TICK_TYPE is TICK_TYPE_HOST and CHRONO_TICK_HOST_SOURCE is a cycle counter
+ *       (TICK_HOST_RDTSC, TICK_HOST_RDTSCP or TICK_HOST_CNTVCT). The tick period of chrono_config.h is only the initial estimate,
+ *       so the same build gives cycle resolution on hosts with different counter frequencies.
+ * 
+ * @note A window of 10 to 100 ms is usually enough for an error of a few ppm. The error is reported in the result.
+ * 
+ * @param windowUs Length of the measurement window in microseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChrono_InitCalibrated(uint32_t windowUs, sChronoCalibration * const result) {
+
+  sChronoClock reference;
+  sChronoClockConfig config = {
+    .TickValue = NULL,
+    .GetTickValue = HostReferenceTick,
+    .TickTopValue = CHRONO_TICK_TOP_VALUE,
+    .TickPeriodNum = 1U,
+    .TickPeriodDen = 1U,
+    .CounterMode = TICK_COUNTERMODE_UP
+  };
+
+  chrono_res_t res = fChrono_Init();
+  if(res != CHRONO_OK) {
+    return res; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  res = ClockInit(&reference, &config);
+  if(res != CHRONO_OK) {
+    return res; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return ClockCalibrate(&_chrono, &reference, (uint64_t)windowUs * 1000U, result);
 }
 #endif
 
@@ -468,12 +696,8 @@ uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
  * @retval isTickAvailable: Is microseconds tick available.
  */
 bool_t fChrono_IsTickUsAvailable(void) {
-  
-  if(!_chrono.Init) {
-    return false;
-  }
-  
-  return _chrono.InitUs;
+
+  return _chrono._init;
 }
 
 /**
@@ -482,12 +706,8 @@ bool_t fChrono_IsTickUsAvailable(void) {
  * @retval isTickAvailable: Is milliseconds tick available.
  */
 bool_t fChrono_IsTickMsAvailable(void) {
-  
-  if(!_chrono.Init) {
-    return false;
-  }
-  
-  return _chrono.InitMs;
+
+  return _chrono._init;
 }
 
 /**
@@ -496,192 +716,357 @@ bool_t fChrono_IsTickMsAvailable(void) {
  * @retval isTickAvailable: Is milliseconds tick available.
  */
 bool_t fChrono_IsTickSAvailable(void) {
-  
-  ASSERT_RETURN_(_chrono.Init, false);
-  
-  return _chrono.InitSec;
+
+  return _chrono._init;
 }
 
 /**
  * @brief Get ram usage by module.
  * 
+ * @note User clocks are allocated by the user and are not included.
+ * 
  * @retval ram usage in byte.
  */
 uint32_t fChrono_GetRamUsage(void) {
-	
-	return sizeof(sChronoInternal);
+
+	return (uint32_t)sizeof(sChronoClock);
 }
 
 /**
- * @brief Get current tick.
+ * @brief Returns the size of one sChrono object.
  * 
- * @note based on CHRONO_TICK_TYPE two cases are possible:
- *         In TICK_TYPE_VARIABLE mode, tick is returned by dereferencing the address of tick value as tick_t.
- *         In TICK_TYPE_FUNCTION mode, tick is returned by calling a user defined function that generates tick value.
- *
- * @retval tick: Current tick (raw)
+ * @note With the sizes of the other objects, it helps to choose the object for applications that keep many timeouts.
+ * 
+ * @retval ram usage of one object in byte.
  */
-tick_t fChrono_GetTick(void) {
+uint32_t fChrono_GetChronoRamUsage(void) {
 
-  ASSERT_RETURN_(_chrono.Init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return GET_TICK_();
+	return (uint32_t)sizeof(sChrono);
 }
 
 /**
- * @brief Returns the continuous tick value converted to microseconds since calling fChrono_Init().
+ * @brief Returns the size of one sChronoDeadline object.
  * 
- * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
- *            make sure fChrono_GetContinuousTickUs() is called once in this interval.
- *
- * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ * @retval ram usage of one object in byte.
  */
-uint64_t fChrono_GetContinuousTickUs(void) {
+uint32_t fChrono_GetDeadlineRamUsage(void) {
 
-  ASSERT_RETURN_(_chrono.Init, 0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  _chrono.ContinuousTickUs += (uint64_t)fChrono_ElapsedUs(&_chrono.ChronoTickUs);
-  
-  START_(&_chrono.ChronoTickUs);
-  
-  return _chrono.ContinuousTickUs;
+	return (uint32_t)sizeof(sChronoDeadline);
 }
 
 /**
- * @brief Returns the continuous tick value converted to milliseconds since calling fChrono_Init().
+ * @brief Returns the size of one sChronoCompact object.
  * 
- * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
- *            make sure fChrono_GetContinuousTickMs() is called once in this interval.
- *
- * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ * @retval ram usage of one object in byte.
  */
-uint64_t fChrono_GetContinuousTickMs(void) {
+uint32_t fChrono_GetCompactRamUsage(void) {
 
-  ASSERT_RETURN_(_chrono.Init, 0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  _chrono.ContinuousTickMs += (uint64_t)fChrono_ElapsedMs(&_chrono.ChronoTickMs);
-  
-  START_(&_chrono.ChronoTickMs);
-  
-  return _chrono.ContinuousTickMs;
+	return (uint32_t)sizeof(sChronoCompact);
 }
 
 /**
- * @brief Returns the continuous tick value converted to seconds since calling fChrono_Init().
+ * @brief Returns the default clock.
  * 
- * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
- *            make sure fChrono_GetContinuousTickS() is called once in this interval.
- *
- * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ * @note The default clock is configured in chrono_config.h and initialized by fChrono_Init(). fChrono_xxx() functions work on this clock,
+ *       so passing it to fChronoClock_xxx() functions gives the same results.
+ * 
+ * @retval clock: Pointer to the default clock
  */
-uint64_t fChrono_GetContinuousTickS(void) {
+sChronoClock const * fChrono_GetDefaultClock(void) {
 
-  ASSERT_RETURN_(_chrono.Init, 0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  _chrono.ContinuousTickS += (uint64_t)fChrono_ElapsedS(&_chrono.ChronoTickS);
-  
-  START_(&_chrono.ChronoTickS);
-  
-  return _chrono.ContinuousTickS;
+  return &_chrono;
 }
 
+#ifndef CHRONO_INLINE
 /**
- * @brief Get Tick top value.
+ * @brief Get current tick.
  * 
- * @note User can get adjusted tick top value, using this function. It returns the same value that was taken from user in fChrono_Init().
+ * @note based on CHRONO_TICK_TYPE three cases are possible:
+ *         In TICK_TYPE_VARIABLE mode, tick is returned by dereferencing the address of tick value as tick_t.
+ *         In TICK_TYPE_FUNCTION mode, tick is returned by calling a user defined function that generates tick value.
+ *         In TICK_TYPE_HOST mode, tick is read inline from the host counter of chrono_config.h.
  * 
- * @retval topValue: Tick top value
+ * @retval tick: Current tick (raw)
  */
-tick_t fChrono_GetTickTopValue(void) {
-  
-  ASSERT_RETURN_(_chrono.Init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return _chrono.TickTopValue;
+tick_t fChrono_GetTick(void) {
+
+  ASSERT_RETURN_(_chrono._init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_GET_TICK_(&_chrono, CHRONO_TICK_TYPE);
 }
+#endif
 
 /**
- * @brief Get Tick init value.
- * 
- * @note User can get tick init value, using this function. It returns the tick value when calling fChrono_Init().
+ * @brief Get current tick of the clock.
  * 
- * @retval initValue: Tick init value
+ * @param clock Pointer to the clock object
+ * @retval tick: Current tick (raw)
  */
-tick_t fChrono_GetTickInitValue(void) {
-  
-  ASSERT_RETURN_(_chrono.Init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return _chrono.TickInitValue;
+tick_t fChronoClock_GetTick(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_GET_TICK_(clock, clock->_tickType);
 }
 
 /**
- * @brief Returns the coefficient for converting one tick to nanoseconds.
- * 
- * @note This coefficient is used to convert ticks (which are unitless) to time lengths with proper units.
+ * @brief Returns the number of ticks of the default clock since calling fChrono_Init(), extended to 64 bits.
  * 
- * @note The **chrono** module cannot measure time lengths smaller than this multiplier.
+ * @note This function is lock-free and re-entrant. It never disables interrupts and never waits for another context.
  * 
- * @note Other multipliers (tick to milliseconds and tick to seconds) are calculated based on this coefficient.
+ * @attention Always remember to call this function before tick generator overflows.
  * 
- * @retval tickToNsCoef: Tick-to-nanoseconds coefficient
+ * @retval tick64: Ticks since calling fChrono_Init()
  */
-uint32_t fChrono_GetTickToNsCoef(void) {
-  
-  ASSERT_RETURN_(_chrono.Init, 0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return _chrono.TickToNsCoef;
+uint64_t fChrono_GetTick64(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockTick64(CHRONO_DEFAULT_CLOCK_);
 }
 
 /**
- * @brief Returns the pointer to the tick generator.
+ * @brief Returns the number of ticks of the clock since calling fChronoClock_Init(), extended to 64 bits.
  * 
- * @retval tickPointer: Pointer to the tick generator.
+ * @note This function is lock-free and re-entrant. It never disables interrupts and never waits for another context.
+ * 
+ * @attention Always remember to call this function before tick generator of the clock overflows.
+ * 
+ * @param clock Pointer to the clock object
+ * @retval tick64: Ticks since calling fChronoClock_Init()
  */
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-
-  volatile tick_t* fChrono_GetTickPointer(void) {
-    
-    ASSERT_RETURN_(_chrono.Init, NULL); /* MISRA 2012 Rule 15.5 deviation */
-  
-    return _chrono.pTickValue;
-  }
+uint64_t fChronoClock_GetTick64(sChronoClock const * const clock) {
 
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
 
-  fpTick_t fChrono_GetTickPointer(void) {
-    
-    ASSERT_RETURN_(_chrono.Init, NULL); /* MISRA 2012 Rule 15.5 deviation */
-    
-    return _chrono.GetTickValue;
-  }
+  return ChronoClockTick64(CHRONO_CLOCK_(clock));
+}
 
-#else
+/**
+ * @brief Observes the tick of the default clock, so its overflow is counted in the 64-bit tick.
+ * 
+ * @note Call this function from the overflow interrupt of the tick generator, or periodically at least once per period of the tick generator,
+ *       if the application may not read the time of the default clock in such an interval. It is lock-free and can preempt any function of the module.
+ * 
+ */
+void fChrono_UpdateTimebase(void) {
 
-  #error "CHRONO_TICK_TYPE must be defined"
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
 
-#endif
+  (void)ChronoClockTick64(CHRONO_DEFAULT_CLOCK_);
+}
 
 /**
- * @brief Returns the maximum measurable time interval in seocnds that can be counted by the tick generator until it reaches its top value.
+ * @brief Observes the tick of the clock, so its overflow is counted in the 64-bit tick.
  * 
- * @retval maxTime: Maximum measurable time interval (seconds)
+ * @note Call this function from the overflow interrupt of the tick generator of the clock, or periodically at least once per period of it.
+ * 
+ * @param clock Pointer to the clock object
  */
-timeS_t fChrono_GetMaxMeasurableTimeS(void) {
-  
-  ASSERT_RETURN_(_chrono.InitSec, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return (timeS_t)_chrono.TickTopValue / _chrono.SecToTickCoef;
+void fChronoClock_UpdateTimebase(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_(clock); /* MISRA 2012 Rule 15.5 deviation */
+
+  (void)ChronoClockTick64(CHRONO_CLOCK_(clock));
 }
 
 /**
- * @brief Returns the maximum measurable time interval in milliseocnds that can be counted by the tick generator until it reaches its top value.
+ * @brief Returns the continuous tick value converted to microseconds since calling fChrono_Init().
+ * 
+ * @note This function is lock-free and re-entrant. The time is calculated from the 64-bit tick of the default clock, so nothing is lost
+ *       by rounding between the calls.
+ * 
+ * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
+ *            make sure fChrono_GetContinuousTickUs() or fChrono_GetTick64() is called once in this interval.
+ * 
+ * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ */
+uint64_t fChrono_GetContinuousTickUs(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoScaleApply(&_chrono._tickToUs, ChronoClockTick64(CHRONO_DEFAULT_CLOCK_));
+}
+
+/**
+ * @brief Returns the continuous tick value converted to milliseconds since calling fChrono_Init().
+ * 
+ * @note This function is lock-free and re-entrant. The time is calculated from the 64-bit tick of the default clock, so nothing is lost
+ *       by rounding between the calls.
+ * 
+ * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
+ *            make sure fChrono_GetContinuousTickMs() or fChrono_GetTick64() is called once in this interval.
+ * 
+ * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ */
+uint64_t fChrono_GetContinuousTickMs(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoScaleApply(&_chrono._tickToMs, ChronoClockTick64(CHRONO_DEFAULT_CLOCK_));
+}
+
+/**
+ * @brief Returns the continuous tick value converted to seconds since calling fChrono_Init().
+ * 
+ * @note This function is lock-free and re-entrant. The time is calculated from the 64-bit tick of the default clock, so nothing is lost
+ *       by rounding between the calls.
+ * 
+ * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
+ *            make sure fChrono_GetContinuousTickS() or fChrono_GetTick64() is called once in this interval.
+ * 
+ * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
+ */
+uint64_t fChrono_GetContinuousTickS(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoScaleApply(&_chrono._tickToS, ChronoClockTick64(CHRONO_DEFAULT_CLOCK_));
+}
+
+/**
+ * @brief Get Tick top value.
+ * 
+ * @note User can get adjusted tick top value, using this function. It returns the same value that was taken from user in fChrono_Init().
+ * 
+ * @retval topValue: Tick top value
+ */
+tick_t fChrono_GetTickTopValue(void) {
+
+  ASSERT_RETURN_(_chrono._init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return _chrono._tickTopValue;
+}
+
+/**
+ * @brief Get Tick init value.
+ * 
+ * @note User can get tick init value, using this function. It returns the tick value when calling fChrono_Init().
+ * 
+ * @retval initValue: Tick init value
+ */
+tick_t fChrono_GetTickInitValue(void) {
+
+  ASSERT_RETURN_(_chrono._init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return _chrono._tickInitValue;
+}
+
+/**
+ * @brief Returns the coefficient for converting one tick to nanoseconds.
+ * 
+ * @note This coefficient is used to convert ticks (which are unitless) to time lengths with proper units.
+ * 
+ * @note The **chrono** module cannot measure time lengths smaller than this multiplier.
+ * 
+ * @note If the tick period is fractional (CHRONO_TICK_PERIOD_NUM and CHRONO_TICK_PERIOD_DEN are defined), this is the integer part of the period.
+ *       Conversions use the exact ratio, which is available through fChrono_GetTickPeriodNum() and fChrono_GetTickPeriodDen().
+ * 
+ * @retval tickToNsCoef: Tick-to-nanoseconds coefficient
+ */
+uint32_t fChrono_GetTickToNsCoef(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return _chrono._tickToNsCoef;
+}
+
+/**
+ * @brief Returns the numerator of the tick period in nanoseconds.
+ * 
+ * @retval tickPeriodNum: Tick period numerator
+ */
+uint32_t fChrono_GetTickPeriodNum(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return _chrono._tickPeriodNum;
+}
+
+/**
+ * @brief Returns the denominator of the tick period in nanoseconds.
+ * 
+ * @retval tickPeriodDen: Tick period denominator
+ */
+uint32_t fChrono_GetTickPeriodDen(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return _chrono._tickPeriodDen;
+}
+
+/**
+ * @brief Returns the pointer to the tick generator.
+ * 
+ * @retval tickPointer: Pointer to the tick generator.
+ */
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+
+  volatile tick_t* fChrono_GetTickPointer(void) {
+
+    ASSERT_RETURN_(_chrono._init, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+    return _chrono._pTickValue;
+  }
+
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+
+  fpTick_t fChrono_GetTickPointer(void) {
+
+    ASSERT_RETURN_(_chrono._init, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+    return _chrono._getTickValue;
+  }
+
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+
+  fpTick_t fChrono_GetTickPointer(void) {
+
+    ASSERT_RETURN_(_chrono._init, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+    return _chrono._getTickValue;
+  }
+
+  /**
+   * @brief Reads the host counter that is selected by CHRONO_TICK_HOST_SOURCE.
+   * 
+   * @note The default clock reads the counter inline. This function is for user clocks and for code that needs a tick function pointer.
+   * 
+   * @retval tick: Current value of the host counter
+   */
+  tick_t fChrono_GetHostTick(void) {
+
+    return ChronoHostTick();
+  }
+
+#else
+
+  #error "CHRONO_TICK_TYPE must be defined"
+
+#endif
+
+/**
+ * @brief Returns the maximum measurable time interval in seocnds that can be counted by the tick generator until it reaches its top value.
+ * 
+ * @retval maxTime: Maximum measurable time interval (seconds)
+ */
+timeS_t fChrono_GetMaxMeasurableTimeS(void) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, _chrono._tickTopValue);
+}
+
+/**
+ * @brief Returns the maximum measurable time interval in milliseocnds that can be counted by the tick generator until it reaches its top value.
  * 
  * @retval maxTime: Maximum measurable time interval (milliseocnds)
  */
 timeMs_t fChrono_GetMaxMeasurableTimeMs(void) {
-  
-  ASSERT_RETURN_(_chrono.InitMs, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return (timeMs_t)_chrono.TickTopValue / _chrono.MsToTickCoef;
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, _chrono._tickTopValue);
 }
 
 /**
@@ -690,10 +1075,37 @@ timeMs_t fChrono_GetMaxMeasurableTimeMs(void) {
  * @retval maxTime: Maximum measurable time interval (microseocnds)
  */
 timeUs_t fChrono_GetMaxMeasurableTimeUs(void) {
-  
-  ASSERT_RETURN_(_chrono.InitUs, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return (timeUs_t)_chrono.TickTopValue / _chrono.UsToTickCoef;
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, _chrono._tickTopValue);
+}
+
+/**
+ * @brief Same as fChrono_GetMaxMeasurableTimeS(), fChrono_GetMaxMeasurableTimeMs() and fChrono_GetMaxMeasurableTimeUs() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @retval maxTime: Maximum measurable time interval
+ */
+timeS_t fChronoClock_GetMaxMeasurableTimeS(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(clock, clock->_tickTopValue);
+}
+
+timeMs_t fChronoClock_GetMaxMeasurableTimeMs(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(clock, clock->_tickTopValue);
+}
+
+timeUs_t fChronoClock_GetMaxMeasurableTimeUs(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(clock, clock->_tickTopValue);
 }
 
 /**
@@ -704,10 +1116,10 @@ timeUs_t fChrono_GetMaxMeasurableTimeUs(void) {
  * @retval timeSpan: Time length between two time stamps (seconds)
  */
 timeS_t fChrono_TimeSpanS(tick_t startTick, tick_t endTick) {
-  
-  ASSERT_RETURN_(_chrono.InitSec, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return TIMESPAN_S_(startTick, endTick);
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, CHRONO_ELAPSED_(&_chrono, CHRONO_DEFAULT_COUNTERMODE_, endTick, startTick));
 }
 
 /**
@@ -718,10 +1130,10 @@ timeS_t fChrono_TimeSpanS(tick_t startTick, tick_t endTick) {
  * @retval timeSpan: Time length between two time stamps (milliseconds)
  */
 timeMs_t fChrono_TimeSpanMs(tick_t startTick, tick_t endTick) {
-  
-  ASSERT_RETURN_(_chrono.InitMs, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return TIMESPAN_MS_(startTick, endTick);
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, CHRONO_ELAPSED_(&_chrono, CHRONO_DEFAULT_COUNTERMODE_, endTick, startTick));
 }
 
 /**
@@ -732,10 +1144,10 @@ timeMs_t fChrono_TimeSpanMs(tick_t startTick, tick_t endTick) {
  * @retval timeSpan: Time length between two time stamps (microseconds)
  */
 timeUs_t fChrono_TimeSpanUs(tick_t startTick, tick_t endTick) {
-  
-  ASSERT_RETURN_(_chrono.InitUs, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return TIMESPAN_US_(startTick, endTick);
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, CHRONO_ELAPSED_(&_chrono, CHRONO_DEFAULT_COUNTERMODE_, endTick, startTick));
 }
 
 /**
@@ -746,10 +1158,93 @@ timeUs_t fChrono_TimeSpanUs(tick_t startTick, tick_t endTick) {
  * @retval timeSpan: Time length between two time stamps (ticks)
  */
 tick_t fChrono_TimeSpanTick(tick_t startTick, tick_t endTick) {
-  
-  ASSERT_RETURN_(_chrono.Init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  return (tick_t)(ELAPSED_(endTick, startTick));
+
+  ASSERT_RETURN_(_chrono._init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (tick_t)(CHRONO_ELAPSED_(&_chrono, CHRONO_DEFAULT_COUNTERMODE_, endTick, startTick));
+}
+
+/**
+ * @brief Returns the time length in nanoseconds between two time ticks.
+ * 
+ * @note The tick count is converted with 64-bit math, so the result keeps the resolution of the tick generator.
+ * 
+ * @param startTick Start tick
+ * @param endTick End tick
+ * @retval timeSpan: Time length between two time stamps (nanoseconds)
+ */
+uint64_t fChrono_TimeSpanNs(tick_t startTick, tick_t endTick) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(&_chrono, CHRONO_ELAPSED_(&_chrono, CHRONO_DEFAULT_COUNTERMODE_, endTick, startTick));
+}
+
+/**
+ * @brief Same as fChrono_TimeSpanS(), fChrono_TimeSpanMs(), fChrono_TimeSpanUs(), fChrono_TimeSpanTick() and fChrono_TimeSpanNs() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param startTick Start tick
+ * @param endTick End tick
+ * @retval timeSpan: Time length between two time stamps
+ */
+timeS_t fChronoClock_TimeSpanS(sChronoClock const * const clock, tick_t startTick, tick_t endTick) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(clock, CHRONO_ELAPSED_(clock, clock->_counterMode, endTick, startTick));
+}
+
+timeMs_t fChronoClock_TimeSpanMs(sChronoClock const * const clock, tick_t startTick, tick_t endTick) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(clock, CHRONO_ELAPSED_(clock, clock->_counterMode, endTick, startTick));
+}
+
+timeUs_t fChronoClock_TimeSpanUs(sChronoClock const * const clock, tick_t startTick, tick_t endTick) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(clock, CHRONO_ELAPSED_(clock, clock->_counterMode, endTick, startTick));
+}
+
+tick_t fChronoClock_TimeSpanTick(sChronoClock const * const clock, tick_t startTick, tick_t endTick) {
+
+  ASSERT_CLOCK_RETURN_(clock, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (tick_t)(CHRONO_ELAPSED_(clock, clock->_counterMode, endTick, startTick));
+}
+
+uint64_t fChronoClock_TimeSpanNs(sChronoClock const * const clock, tick_t startTick, tick_t endTick) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(clock, CHRONO_ELAPSED_(clock, clock->_counterMode, endTick, startTick));
+}
+
+/**
+ * @brief Converts a time length in microseconds to ticks.
+ * 
+ * @note The conversion is the same as the one of fChrono_StartTimeoutUs(), and it keeps the fraction of a floating point time type.
+ *       Unlike the timeout of a chrono object, the result is not truncated to the tick range, so it can be passed to fChrono_DelayTicks()
+ *       or to the tick functions of the other modules.
+ * 
+ * @param time Time length (microseconds)
+ * @retval ticks: Number of ticks
+ */
+uint64_t fChrono_UsToTicks(timeUs_t time) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TIME_TO_TICK64_(timeUs_t, time, _chrono._usToTick);
+}
+
+uint64_t fChronoClock_UsToTicks(sChronoClock const * const clock, timeUs_t time) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TIME_TO_TICK64_(timeUs_t, time, clock->_usToTick);
 }
 
 /**
@@ -761,12 +1256,10 @@ tick_t fChrono_TimeSpanTick(tick_t startTick, tick_t endTick) {
  */
 void fChrono_DelayS(timeS_t delayS) {
 
-  ASSERT_(_chrono.InitSec); /* MISRA 2012 Rule 15.5 deviation */
-  
-  tick_t startTick = GET_TICK_();
-  tick_t delayTick = delayS * _chrono.SecToTickCoef;
-  
-  DELAY_TICK_(startTick, delayTick);
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t startTick = ChronoClockNow(CHRONO_DEFAULT_CLOCK_);
+  DelayTick(CHRONO_DEFAULT_CLOCK_, startTick, S_TO_TICK_(&_chrono, delayS));
 }
 
 /**
@@ -778,12 +1271,10 @@ void fChrono_DelayS(timeS_t delayS) {
  */
 void fChrono_DelayMs(timeMs_t delayMs) {
 
-  ASSERT_(_chrono.InitMs); /* MISRA 2012 Rule 15.5 deviation */
-  
-  tick_t startTick = GET_TICK_();
-  tick_t delayTick = delayMs * _chrono.MsToTickCoef;
-  
-  DELAY_TICK_(startTick, delayTick);
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t startTick = ChronoClockNow(CHRONO_DEFAULT_CLOCK_);
+  DelayTick(CHRONO_DEFAULT_CLOCK_, startTick, MS_TO_TICK_(&_chrono, delayMs));
 }
 
 /**
@@ -795,406 +1286,2191 @@ void fChrono_DelayMs(timeMs_t delayMs) {
  */
 void fChrono_DelayUs(timeUs_t delayUs) {
 
-  ASSERT_(_chrono.InitUs); /* MISRA 2012 Rule 15.5 deviation */
-  
-  tick_t startTick = GET_TICK_();
-  tick_t delayTick = delayUs * _chrono.UsToTickCoef;
-  
-  DELAY_TICK_(startTick, delayTick);
-}
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
 
-/** @} */ //End of FUNCTIONAL_API
+  chronoTick_t startTick = ChronoClockNow(CHRONO_DEFAULT_CLOCK_);
+  DelayTick(CHRONO_DEFAULT_CLOCK_, startTick, US_TO_TICK_(&_chrono, delayUs));
+}
 
-/** @defgroup OBJECTIVE_API Objective API in the chrono module
- *  @brief These functions require an object of type sChrono. Users must declare one to use them.
- *  @{
+/**
+ * @brief Same as fChrono_DelayS(), fChrono_DelayMs() and fChrono_DelayUs() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param delay Delay time length
  */
+void fChronoClock_DelayS(sChronoClock const * const clock, timeS_t delayS) {
+
+  ASSERT_CLOCK_(clock); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t startTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+  DelayTick(CHRONO_CLOCK_(clock), startTick, S_TO_TICK_(clock, delayS));
+}
+
+void fChronoClock_DelayMs(sChronoClock const * const clock, timeMs_t delayMs) {
+
+  ASSERT_CLOCK_(clock); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t startTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+  DelayTick(CHRONO_CLOCK_(clock), startTick, MS_TO_TICK_(clock, delayMs));
+}
+
+void fChronoClock_DelayUs(sChronoClock const * const clock, timeUs_t delayUs) {
+
+  ASSERT_CLOCK_(clock); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t startTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+  DelayTick(CHRONO_CLOCK_(clock), startTick, US_TO_TICK_(clock, delayUs));
+}
 
 /**
- * @brief Starts the chrono object for measuring time.
+ * @brief Generates a delay in ticks of the clock.
  * 
- * @note This function puts the chrono object in the run state.
+ * @note Unlike the other delays, the delay can be longer than the tick range. A delay longer than half of the tick range is split into parts,
+ *       because the elapsed ticks of a longer part could wrap around between two reads. With CHRONO_TICK_EXTENSION it is one part.
+ * 
+ * @param delayTick Delay time length (ticks)
+ */
+void fChrono_DelayTicks(uint64_t delayTick) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+
+  DelayTicks(CHRONO_DEFAULT_CLOCK_, delayTick);
+}
+
+void fChronoClock_DelayTicks(sChronoClock const * const clock, uint64_t delayTick) {
+
+  ASSERT_CLOCK_(clock); /* MISRA 2012 Rule 15.5 deviation */
+
+  DelayTicks(CHRONO_CLOCK_(clock), delayTick);
+}
+
+#ifdef CHRONO_DELAY_SLEEP
+/**
+ * @brief Sets the function that the delay functions call to sleep for the bulk of a delay.
+ * 
+ * @note The delays sleep until the time left is shorter than the spin window, then they spin. The function may return early, e.g., a function
+ *       that only executes __WFI() returns on the next interrupt, so a periodic interrupt such as SysTick is enough to wake it up.
+ *       If it returns late, the lateness is the wake-up latency and the spin window grows to cover it.
+ * 
+ * @note With TICK_TYPE_HOST, the default function sleeps with clock_nanosleep(). NULL disables the sleep and the delays busy-wait.
+ *       The spin window is reset to CHRONO_DELAY_SPIN_NS.
+ * 
+ * @param sleep Pointer to the sleep function
+ */
+void fChrono_SetDelaySleep(fpSleep_t sleep) {
+
+  _delaySleep = sleep;
+  _delaySpinWindowNs = CHRONO_DELAY_SPIN_NS;
+}
+
+/**
+ * @brief Returns the length of the last part of a delay that is spun instead of slept.
+ * 
+ * @note The window moves halfway up to 1.25 times the latency of a late wake-up and slowly decays when the sleep function wakes up on time.
+ *       It stays between 1 us and CHRONO_DELAY_SPIN_MAX_NS.
+ * 
+ * @retval spinWindow: Spin window of the delays (nanoseconds)
+ */
+uint32_t fChrono_GetDelaySpinWindowNs(void) {
+
+  return _delaySpinWindowNs;
+}
+#endif
+
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+/**
+ * @brief Returns the fixed cost of a delay of the default clock, which is subtracted from every delay.
+ * 
+ * @note It is measured by the init function as the ticks of fChrono_DelayUs(0), minus the ticks of two back-to-back tick reads.
+ *       It covers the call, the assertions, the conversion of the delay to ticks and the tick reads inside the delay.
+ * 
+ * @retval overhead: Delay overhead (ticks)
+ */
+uint64_t fChrono_GetDelayOverheadTick(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)_chrono._delayOverhead;
+}
+
+/**
+ * @brief Returns the ticks of a measurement of the default clock with nothing between fChrono_Start() and fChrono_ElapsedTick().
+ * 
+ * @note The elapsed functions subtract them from the elapsed ticks, so a tic_()/tocUs_() pair around an empty block returns zero.
+ * 
+ * @retval overhead: Elapsed overhead (ticks)
+ */
+uint64_t fChrono_GetElapsedOverheadTick(void) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)_chrono._elapsedOverhead;
+}
+
+/**
+ * @brief Same as fChrono_GetDelayOverheadTick() and fChrono_GetElapsedOverheadTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @retval overhead: Overhead (ticks)
+ */
+uint64_t fChronoClock_GetDelayOverheadTick(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)clock->_delayOverhead;
+}
+
+uint64_t fChronoClock_GetElapsedOverheadTick(sChronoClock const * const clock) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)clock->_elapsedOverhead;
+}
+#endif
+
+/** @} */ //End of FUNCTIONAL_API
+
+/** @defgroup OBJECTIVE_API Objective API in the chrono module
+ *  @brief These functions require an object of type sChrono. Users must declare one to use them.
+ *  @{
+ */
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Starts the chrono object for measuring time.
+ * 
+ * @note This function puts the chrono object in the run state.
  *       Functions like fChrono_ElapsedS() or fChrono_IntervalUs() only return measured values if there is a start time tag already.
  *       Therefore, this function must be called before any time measurement.
  * 
  * @param me Pointer to the chrono object
  */
 void fChrono_Start(sChrono * const me) {
-  
-  ASSERT_(_chrono.Init);  /* MISRA 2012 Rule 15.5 deviation */
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
   ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_startTick = GET_TICK_();
-  me->_run = TRUE;
+
+  ChronoClockStart(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Stops the chrono object to signal the end of time measurement.
+ * 
+ * @note This function stops the chrono object and puts it in the stop state. Measurements are not valid in this case, and corresponding functions return 0.
+ * 
+ * @param me Pointer to the chrono object
+ */
+void fChrono_Stop(sChrono * const me) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStop(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+/**
+ * @brief Same as fChrono_Start() and fChrono_Stop() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ */
+void fChronoClock_Start(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStart(CHRONO_CLOCK_(clock), me);
+}
+
+void fChronoClock_Stop(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStop(CHRONO_CLOCK_(clock), me);
+}
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Returns the elapsed time in seconds since the start of the measurement using fChrono_Start().
+ * 
+ * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time since starting the chrono object (seconds)
+ */
+timeS_t fChrono_ElapsedS(sChrono const * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the elapsed time in milliseconds since the start of the measurement using fChrono_Start().
+ * 
+ * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time since starting the chrono object (milliseconds)
+ */
+timeMs_t fChrono_ElapsedMs(sChrono const * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the elapsed time in microseconds since the start of the measurement using fChrono_Start().
+ * 
+ * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time since starting the chrono object (microseconds)
+ */
+timeUs_t fChrono_ElapsedUs(sChrono const * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the elapsed time in nanoseconds since the start of the measurement using fChrono_Start().
+ * 
+ * @note The elapsed ticks are converted with 64-bit math, so the result keeps the resolution of the tick generator below 1 microsecond.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time since starting the chrono object (nanoseconds)
+ */
+uint64_t fChrono_ElapsedNs(sChrono const * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the elapsed ticks since the start of the measurement using fChrono_Start().
+ * 
+ * @note No conversion is done, so this is the cheapest way to measure a code section. Convert the result to time only when it is reported,
+ *       e.g., with fChrono_TimeSpanNs(0, ticks) for spans shorter than one period of the tick generator.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed ticks since starting the chrono object
+ */
+uint64_t fChrono_ElapsedTick(sChrono const * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Same as fChrono_ElapsedS(), fChrono_ElapsedMs(), fChrono_ElapsedUs(), fChrono_ElapsedNs() and fChrono_ElapsedTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time since starting the chrono object
+ */
+timeS_t fChronoClock_ElapsedS(sChronoClock const * const clock, sChrono const * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(clock, ChronoClockElapsedTick(CHRONO_CLOCK_(clock), me));
+}
+
+timeMs_t fChronoClock_ElapsedMs(sChronoClock const * const clock, sChrono const * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(clock, ChronoClockElapsedTick(CHRONO_CLOCK_(clock), me));
+}
+
+timeUs_t fChronoClock_ElapsedUs(sChronoClock const * const clock, sChrono const * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(clock, ChronoClockElapsedTick(CHRONO_CLOCK_(clock), me));
+}
+
+uint64_t fChronoClock_ElapsedNs(sChronoClock const * const clock, sChrono const * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(clock, ChronoClockElapsedTick(CHRONO_CLOCK_(clock), me));
+}
+
+uint64_t fChronoClock_ElapsedTick(sChronoClock const * const clock, sChrono const * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockElapsedTick(CHRONO_CLOCK_(clock), me);
+}
+
+/**
+ * @brief Returns the remaining time in seconds until the chrono object reaches its timeout.
+ * 
+ * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
+ * 
+ * @note This function works correctly if a timeout has occurred, returning zero in that case.
+ *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval timeLeft: Time length until timeout (seconds)
+ */
+timeS_t fChrono_LeftS(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_DEFAULT_CLOCK_, me, &elapsedTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_S_(&_chrono, me->_timeout, elapsedTick);
+}
+
+/**
+ * @brief Returns the remaining time in milliseconds until the chrono object reaches its timeout.
+ * 
+ * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
+ * 
+ * @note This function works correctly if a timeout has occurred, returning zero in that case.
+ *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval timeLeft: Time length until timeout (milliseconds)
+ */
+timeMs_t fChrono_LeftMs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_DEFAULT_CLOCK_, me, &elapsedTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_MS_(&_chrono, me->_timeout, elapsedTick);
+}
+
+/**
+ * @brief Returns the remaining time in microseconds until the chrono object reaches its timeout.
+ * 
+ * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
+ * 
+ * @note This function works correctly if a timeout has occurred, returning zero in that case.
+ *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval timeLeft: Time length until timeout (microseconds)
+ */
+timeUs_t fChrono_LeftUs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_DEFAULT_CLOCK_, me, &elapsedTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_US_(&_chrono, me->_timeout, elapsedTick);
+}
+
+/**
+ * @brief Returns the remaining time in nanoseconds until the chrono object reaches its timeout.
+ * 
+ * @note The remaining ticks are converted with 64-bit math, so the result keeps the resolution of the tick generator.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval timeLeft: Time length until timeout (nanoseconds)
+ */
+uint64_t fChrono_LeftNs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_DEFAULT_CLOCK_, me, &elapsedTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(&_chrono, me->_timeout - elapsedTick);
+}
+
+/**
+ * @brief Returns the remaining ticks until the chrono object reaches its timeout.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval tickLeft: Ticks until timeout
+ */
+uint64_t fChrono_LeftTick(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_DEFAULT_CLOCK_, me, &elapsedTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)(me->_timeout - elapsedTick);
+}
+
+/**
+ * @brief Same as fChrono_LeftS(), fChrono_LeftMs(), fChrono_LeftUs(), fChrono_LeftNs() and fChrono_LeftTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @retval timeLeft: Time length until timeout
+ */
+timeS_t fChronoClock_LeftS(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_CLOCK_(clock), me, &elapsedTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_S_(clock, me->_timeout, elapsedTick);
+}
+
+timeMs_t fChronoClock_LeftMs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_CLOCK_(clock), me, &elapsedTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_MS_(clock, me->_timeout, elapsedTick);
+}
+
+timeUs_t fChronoClock_LeftUs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_CLOCK_(clock), me, &elapsedTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return LEFT_US_(clock, me->_timeout, elapsedTick);
+}
+
+uint64_t fChronoClock_LeftNs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_CLOCK_(clock), me, &elapsedTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(clock, me->_timeout - elapsedTick);
+}
+
+uint64_t fChronoClock_LeftTick(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t elapsedTick;
+  if(!ChronoClockLeftTick(CHRONO_CLOCK_(clock), me, &elapsedTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)(me->_timeout - elapsedTick);
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out (seconds)
+ */
+void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_DEFAULT_CLOCK_, me, S_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out (milliseconds)
+ */
+void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_DEFAULT_CLOCK_, me, MS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out (microseconds)
+ */
+void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_DEFAULT_CLOCK_, me, US_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out (nanoseconds)
+ */
+void fChrono_StartTimeoutNs(sChrono * const me, uint64_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_DEFAULT_CLOCK_, me, NS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @note Unless CHRONO_TICK_EXTENSION is defined, the timeout must be shorter than one period of the tick generator.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Number of ticks until the chrono object times out
+ */
+void fChrono_StartTimeoutTicks(sChrono * const me, uint64_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_DEFAULT_CLOCK_, me, (chronoTick_t)timeout);
+}
+
+/**
+ * @brief Same as fChrono_StartTimeoutS(), fChrono_StartTimeoutMs(), fChrono_StartTimeoutUs(), fChrono_StartTimeoutNs() and fChrono_StartTimeoutTicks() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out
+ */
+void fChronoClock_StartTimeoutS(sChronoClock const * const clock, sChrono * const me, timeS_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_CLOCK_(clock), me, S_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_StartTimeoutMs(sChronoClock const * const clock, sChrono * const me, timeMs_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_CLOCK_(clock), me, MS_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_StartTimeoutUs(sChronoClock const * const clock, sChrono * const me, timeUs_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_CLOCK_(clock), me, US_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_StartTimeoutNs(sChronoClock const * const clock, sChrono * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_CLOCK_(clock), me, NS_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_StartTimeoutTicks(sChronoClock const * const clock, sChrono * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStartTimeout(CHRONO_CLOCK_(clock), me, (chronoTick_t)timeout);
+}
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Returns the timeout status of the chrono object.
+ * 
+ * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval isTimeout: TRUE if the chrono is timed out, otherwise returns FALSE
+ */
+bool_t fChrono_IsTimeout(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Same as fChrono_IsTimeout() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @retval isTimeout: TRUE if the chrono is timed out, otherwise returns FALSE
+ */
+bool_t fChronoClock_IsTimeout(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockIsTimeout(CHRONO_CLOCK_(clock), me);
+}
+
+/**
+ * @brief Returns TRUE if a period of the chrono object is due. The chrono object must be started with one of the fChrono_StartTimeoutXX() functions,
+ *        and its timeout is the period.
+ * 
+ * @note Unlike restarting the timeout after it expires, the next period starts at the end of the due one, so the period doesn't drift with the lateness of the calls.
+ *       When the object is polled later than one period, "policy" selects how the missed periods are handled and "missed" receives their number.
+ * 
+ * @param me Pointer to the chrono object
+ * @param policy Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE
+ * @param missed Receives the number of whole periods that were missed in addition to the due one. It can be NULL.
+ * @retval isDue: TRUE if a period is due, otherwise returns FALSE
+ */
+bool_t fChrono_IsPeriodDue(sChrono * const me, uint8_t policy, uint32_t * const missed) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockIsPeriodDue(CHRONO_DEFAULT_CLOCK_, me, policy, missed);
+}
+
+/**
+ * @brief Same as fChrono_IsPeriodDue() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @param policy Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE
+ * @param missed Receives the number of whole periods that were missed in addition to the due one. It can be NULL.
+ * @retval isDue: TRUE if a period is due, otherwise returns FALSE
+ */
+bool_t fChronoClock_IsPeriodDue(sChronoClock const * const clock, sChrono * const me, uint8_t policy, uint32_t * const missed) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockIsPeriodDue(CHRONO_CLOCK_(clock), me, policy, missed);
+}
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Returns the time interval in seconds between two consecutive calls to this function.
+ * 
+ * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
+ *       between the current tick and the last time fChrono_IntervalS() was called.
+ * 
+ * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalS() function calls.
+ * 
+ * @note A practical use case is measuring the time interval during the execution of a periodic function.
+ *       By invoking fChrono_IntervalS() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval interval: Time interval between two consecutive calls of the function (seconds)
+ */
+timeS_t fChrono_IntervalS(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the time interval in milliseconds between two consecutive calls to this function.
+ * 
+ * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
+ *       between the current tick and the last time fChrono_IntervalMs() was called.
+ * 
+ * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalMs() function calls.
+ * 
+ * @note A practical use case is measuring the time interval during the execution of a periodic function.
+ *       By invoking fChrono_IntervalMs() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval interval: Time interval between two consecutive calls of the function (milliseconds)
+ */
+timeMs_t fChrono_IntervalMs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the time interval in microseconds between two consecutive calls to this function.
+ * 
+ * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
+ *       between the current tick and the last time fChrono_IntervalUs() was called.
+ * 
+ * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalUs() function calls.
+ * 
+ * @note A practical use case is measuring the time interval during the execution of a periodic function.
+ *       By invoking fChrono_IntervalUs() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval interval: Time interval between two consecutive calls of the function (microseconds)
+ */
+timeUs_t fChrono_IntervalUs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the time interval in nanoseconds between two consecutive calls to this function.
+ * 
+ * @note It works like fChrono_IntervalUs(), but the interval is converted with 64-bit math and keeps the resolution of the tick generator.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval interval: Time interval between two consecutive calls of the function (nanoseconds)
+ */
+uint64_t fChrono_IntervalNs(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+/**
+ * @brief Returns the number of ticks between two consecutive calls to this function.
+ * 
+ * @note It works like fChrono_IntervalUs(), but no conversion is done.
+ * 
+ * @param me Pointer to the chrono object
+ * @retval interval: Ticks between two consecutive calls of the function
+ */
+uint64_t fChrono_IntervalTick(sChrono * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Same as fChrono_IntervalS(), fChrono_IntervalMs(), fChrono_IntervalUs(), fChrono_IntervalNs() and fChrono_IntervalTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the chrono object
+ * @retval interval: Time interval between two consecutive calls of the function
+ */
+timeS_t fChronoClock_IntervalS(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(clock, ChronoClockIntervalTick(CHRONO_CLOCK_(clock), me));
+}
+
+timeMs_t fChronoClock_IntervalMs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(clock, ChronoClockIntervalTick(CHRONO_CLOCK_(clock), me));
+}
+
+timeUs_t fChronoClock_IntervalUs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(clock, ChronoClockIntervalTick(CHRONO_CLOCK_(clock), me));
+}
+
+uint64_t fChronoClock_IntervalNs(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(clock, ChronoClockIntervalTick(CHRONO_CLOCK_(clock), me));
+}
+
+uint64_t fChronoClock_IntervalTick(sChronoClock const * const clock, sChrono * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockIntervalTick(CHRONO_CLOCK_(clock), me);
+}
+
+/** @} */ //End of OBJECTIVE_API
+
+/** @defgroup DEADLINE_API Deadline API in the chrono module
+ *  @brief These functions require an object of type sChronoDeadline.
+ *  @note A deadline object stores its expiry tick, so fChrono_DeadlineIsTimeout() is cheaper than fChrono_IsTimeout() when many timeouts are polled.
+ *  @{
+ */
+
+/**
+ * @brief Starts the deadline object.
+ * 
+ * @param me Pointer to the deadline object
+ * @param timeout Time length until the deadline object times out (seconds)
+ */
+void fChrono_DeadlineStartS(sChronoDeadline * const me, timeS_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_DEFAULT_CLOCK_, me, S_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the deadline object.
+ * 
+ * @param me Pointer to the deadline object
+ * @param timeout Time length until the deadline object times out (milliseconds)
+ */
+void fChrono_DeadlineStartMs(sChronoDeadline * const me, timeMs_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_DEFAULT_CLOCK_, me, MS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the deadline object.
+ * 
+ * @param me Pointer to the deadline object
+ * @param timeout Time length until the deadline object times out (microseconds)
+ */
+void fChrono_DeadlineStartUs(sChronoDeadline * const me, timeUs_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_DEFAULT_CLOCK_, me, US_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the deadline object.
+ * 
+ * @param me Pointer to the deadline object
+ * @param timeout Time length until the deadline object times out (nanoseconds)
+ */
+void fChrono_DeadlineStartNs(sChronoDeadline * const me, uint64_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_DEFAULT_CLOCK_, me, NS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the deadline object.
+ * 
+ * @note Unless CHRONO_TICK_EXTENSION is defined, the timeout must be shorter than one period of the tick generator.
+ * 
+ * @param me Pointer to the deadline object
+ * @param timeout Number of ticks until the deadline object times out
+ */
+void fChrono_DeadlineStartTicks(sChronoDeadline * const me, uint64_t timeout) {
+
+  ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_DEFAULT_CLOCK_, me, (chronoTick_t)timeout);
+}
+
+/**
+ * @brief Stops the deadline object. fChrono_DeadlineIsTimeout() returns FALSE afterwards.
+ * 
+ * @param me Pointer to the deadline object
+ */
+void fChrono_DeadlineStop(sChronoDeadline * const me) {
+
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  me->_run = FALSE;
+  me->_isTimeout = FALSE;
+}
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Returns the timeout status of the deadline object.
+ * 
+ * @note Before using this function, ensure that one of the fChrono_DeadlineStartXX() functions has been called.
+ * 
+ * @note The current tick is compared with the expiry tick that was computed when the deadline started. Once the deadline object times out,
+ *       it stays timed out until it is started or stopped again.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval isTimeout: TRUE if the deadline object is timed out, otherwise returns FALSE
+ */
+bool_t fChrono_DeadlineIsTimeout(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockDeadlineIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Returns the remaining time in seconds until the deadline object times out.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout (seconds)
+ */
+timeS_t fChrono_DeadlineLeftS(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_S_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in milliseconds until the deadline object times out.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout (milliseconds)
+ */
+timeMs_t fChrono_DeadlineLeftMs(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_MS_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in microseconds until the deadline object times out.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout (microseconds)
+ */
+timeUs_t fChrono_DeadlineLeftUs(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_US_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in nanoseconds until the deadline object times out.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout (nanoseconds)
+ */
+uint64_t fChrono_DeadlineLeftNs(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in ticks until the deadline object times out.
+ * 
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout (ticks)
+ */
+uint64_t fChrono_DeadlineLeftTick(sChronoDeadline * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)leftTick;
+}
+
+/**
+ * @brief Same as fChrono_DeadlineStartS(), fChrono_DeadlineStartMs(), fChrono_DeadlineStartUs(), fChrono_DeadlineStartNs() and fChrono_DeadlineStartTicks() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the deadline object
+ * @param timeout Time length until the deadline object times out
+ */
+void fChronoClock_DeadlineStartS(sChronoClock const * const clock, sChronoDeadline * const me, timeS_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_CLOCK_(clock), me, S_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_DeadlineStartMs(sChronoClock const * const clock, sChronoDeadline * const me, timeMs_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_CLOCK_(clock), me, MS_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_DeadlineStartUs(sChronoClock const * const clock, sChronoDeadline * const me, timeUs_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_CLOCK_(clock), me, US_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_DeadlineStartNs(sChronoClock const * const clock, sChronoDeadline * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_CLOCK_(clock), me, NS_TO_TICK_(clock, timeout));
+}
+
+void fChronoClock_DeadlineStartTicks(sChronoClock const * const clock, sChronoDeadline * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockDeadlineStart(CHRONO_CLOCK_(clock), me, (chronoTick_t)timeout);
+}
+
+/**
+ * @brief Same as fChrono_DeadlineStop() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the deadline object
+ */
+void fChronoClock_DeadlineStop(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  me->_run = FALSE;
+  me->_isTimeout = FALSE;
+}
+
+/**
+ * @brief Same as fChrono_DeadlineIsTimeout() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the deadline object
+ * @retval isTimeout: TRUE if the deadline object is timed out, otherwise returns FALSE
+ */
+bool_t fChronoClock_DeadlineIsTimeout(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockDeadlineIsTimeout(CHRONO_CLOCK_(clock), me);
+}
+
+/**
+ * @brief Same as fChrono_DeadlineLeftS(), fChrono_DeadlineLeftMs(), fChrono_DeadlineLeftUs(), fChrono_DeadlineLeftNs() and fChrono_DeadlineLeftTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the deadline object
+ * @retval timeLeft: Time length until timeout
+ */
+timeS_t fChronoClock_DeadlineLeftS(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_S_(clock, leftTick);
+}
+
+timeMs_t fChronoClock_DeadlineLeftMs(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_MS_(clock, leftTick);
+}
+
+timeUs_t fChronoClock_DeadlineLeftUs(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_US_(clock, leftTick);
+}
+
+uint64_t fChronoClock_DeadlineLeftNs(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(clock, leftTick);
+}
+
+uint64_t fChronoClock_DeadlineLeftTick(sChronoClock const * const clock, sChronoDeadline * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockDeadlineLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)leftTick;
+}
+
+/** @} */ //End of DEADLINE_API
+
+/** @defgroup COMPACT_API Compact API in the chrono module
+ *  @brief These functions require an object of type sChronoCompact.
+ *  @note A compact object takes 2 * sizeof(tick_t) bytes, or 8 bytes with CHRONO_TICK_EXTENSION. The functions behave like the timeout functions of sChrono.
+ *  @{
+ */
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note Timeouts longer than a quarter of the range of the tick field (2^30 - 1 ticks for a 32-bit tick) don't fit in the compact object (see sChronoCompact).
+ *       They are rejected and the compact object is stopped, so it never times out early.
+ * 
+ * @param me Pointer to the compact object
+ * @param timeout Time length until the compact object times out (seconds)
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChrono_CompactStartS(sChronoCompact * const me, timeS_t timeout) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_DEFAULT_CLOCK_, me, S_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note Timeouts longer than a quarter of the range of the tick field (2^30 - 1 ticks for a 32-bit tick) don't fit in the compact object (see sChronoCompact).
+ *       They are rejected and the compact object is stopped, so it never times out early.
+ * 
+ * @param me Pointer to the compact object
+ * @param timeout Time length until the compact object times out (milliseconds)
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChrono_CompactStartMs(sChronoCompact * const me, timeMs_t timeout) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_DEFAULT_CLOCK_, me, MS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note Timeouts longer than a quarter of the range of the tick field (2^30 - 1 ticks for a 32-bit tick) don't fit in the compact object (see sChronoCompact).
+ *       They are rejected and the compact object is stopped, so it never times out early.
+ * 
+ * @param me Pointer to the compact object
+ * @param timeout Time length until the compact object times out (microseconds)
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChrono_CompactStartUs(sChronoCompact * const me, timeUs_t timeout) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_DEFAULT_CLOCK_, me, US_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note Timeouts longer than a quarter of the range of the tick field (2^30 - 1 ticks for a 32-bit tick) don't fit in the compact object (see sChronoCompact).
+ *       They are rejected and the compact object is stopped, so it never times out early.
+ * 
+ * @param me Pointer to the compact object
+ * @param timeout Time length until the compact object times out (nanoseconds)
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChrono_CompactStartNs(sChronoCompact * const me, uint64_t timeout) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_DEFAULT_CLOCK_, me, NS_TO_TICK_(&_chrono, timeout));
+}
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note Unless CHRONO_TICK_EXTENSION is defined, the timeout must be shorter than one period of the tick generator.
+ * @note Timeouts longer than a quarter of the range of the tick field (2^30 - 1 ticks for a 32-bit tick) don't fit in the compact object (see sChronoCompact).
+ *       They are rejected and the compact object is stopped, so it never times out early.
+ * 
+ * @param me Pointer to the compact object
+ * @param timeout Number of ticks until the compact object times out
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChrono_CompactStartTicks(sChronoCompact * const me, uint64_t timeout) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_DEFAULT_CLOCK_, me, timeout);
+}
+
+/**
+ * @brief Stops the compact object. fChrono_CompactIsTimeout() returns FALSE afterwards.
+ * 
+ * @param me Pointer to the compact object
+ */
+void fChrono_CompactStop(sChronoCompact * const me) {
+
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_COMPACT_WORD_(me) = (chronoTick_t)0;
+}
+
+#ifndef CHRONO_INLINE
+/**
+ * @brief Returns the timeout status of the compact object.
+ * 
+ * @note Before using this function, ensure that one of the fChrono_CompactStartXX() functions has been called.
+ * 
+ * @note Once the compact object times out, it stays timed out until it is started or stopped again.
+ * 
+ * @param me Pointer to the compact object
+ * @retval isTimeout: TRUE if the compact object is timed out, otherwise returns FALSE
+ */
+bool_t fChrono_CompactIsTimeout(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+#endif
+
+/**
+ * @brief Returns the remaining time in seconds until the compact object times out.
+ * 
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout (seconds)
+ */
+timeS_t fChrono_CompactLeftS(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_S_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in milliseconds until the compact object times out.
+ * 
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout (milliseconds)
+ */
+timeMs_t fChrono_CompactLeftMs(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_MS_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in microseconds until the compact object times out.
+ * 
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout (microseconds)
+ */
+timeUs_t fChrono_CompactLeftUs(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_US_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in nanoseconds until the compact object times out.
+ * 
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout (nanoseconds)
+ */
+uint64_t fChrono_CompactLeftNs(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(&_chrono, leftTick);
+}
+
+/**
+ * @brief Returns the remaining time in ticks until the compact object times out.
+ * 
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout (ticks)
+ */
+uint64_t fChrono_CompactLeftTick(sChronoCompact * const me) {
+
+  ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U);   /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_DEFAULT_CLOCK_, me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)leftTick;
+}
+
+/**
+ * @brief Same as fChrono_CompactStartS(), fChrono_CompactStartMs(), fChrono_CompactStartUs(), fChrono_CompactStartNs() and fChrono_CompactStartTicks() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the compact object
+ * @param timeout Time length until the compact object times out
+ * @retval isStarted: FALSE if the timeout is too long for the compact object, otherwise returns TRUE
+ */
+bool_t fChronoClock_CompactStartS(sChronoClock const * const clock, sChronoCompact * const me, timeS_t timeout) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_CLOCK_(clock), me, S_TO_TICK_(clock, timeout));
+}
+
+bool_t fChronoClock_CompactStartMs(sChronoClock const * const clock, sChronoCompact * const me, timeMs_t timeout) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_CLOCK_(clock), me, MS_TO_TICK_(clock, timeout));
+}
+
+bool_t fChronoClock_CompactStartUs(sChronoClock const * const clock, sChronoCompact * const me, timeUs_t timeout) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_CLOCK_(clock), me, US_TO_TICK_(clock, timeout));
+}
+
+bool_t fChronoClock_CompactStartNs(sChronoClock const * const clock, sChronoCompact * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_CLOCK_(clock), me, NS_TO_TICK_(clock, timeout));
+}
+
+bool_t fChronoClock_CompactStartTicks(sChronoClock const * const clock, sChronoCompact * const me, uint64_t timeout) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactStart(CHRONO_CLOCK_(clock), me, timeout);
+}
+
+/**
+ * @brief Same as fChrono_CompactStop() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the compact object
+ */
+void fChronoClock_CompactStop(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_(clock);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_COMPACT_WORD_(me) = (chronoTick_t)0;
+}
+
+/**
+ * @brief Same as fChrono_CompactIsTimeout() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the compact object
+ * @retval isTimeout: TRUE if the compact object is timed out, otherwise returns FALSE
+ */
+bool_t fChronoClock_CompactIsTimeout(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, FALSE);   /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactIsTimeout(CHRONO_CLOCK_(clock), me);
+}
+
+/**
+ * @brief Same as fChrono_CompactLeftS(), fChrono_CompactLeftMs(), fChrono_CompactLeftUs(), fChrono_CompactLeftNs() and fChrono_CompactLeftTick() on the specified clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param me Pointer to the compact object
+ * @retval timeLeft: Time length until timeout
+ */
+timeS_t fChronoClock_CompactLeftS(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_S_(clock, leftTick);
+}
+
+timeMs_t fChronoClock_CompactLeftMs(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_MS_(clock, leftTick);
+}
+
+timeUs_t fChronoClock_CompactLeftUs(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_US_(clock, leftTick);
+}
+
+uint64_t fChronoClock_CompactLeftNs(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return CHRONO_TICK_TO_NS_(clock, leftTick);
+}
+
+uint64_t fChronoClock_CompactLeftTick(sChronoClock const * const clock, sChronoCompact * const me) {
+
+  ASSERT_CLOCK_RETURN_(clock, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RETURN_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  chronoTick_t leftTick;
+  if(!ChronoClockCompactLeftTick(CHRONO_CLOCK_(clock), me, &leftTick)) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint64_t)leftTick;
+}
+
+/** @} */ //End of COMPACT_API
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the default clock.
+ * 
+ * @note The continuous time of the default clock starts from zero, because the timebase is reset by ClockInit().
+ * 
+ * @param config Pointer to the configuration of the default clock
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+static uint8_t InitDefault(sChronoClockConfig const * const config) {
+
+  uint8_t res = ClockInit(&_chrono, config);
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+  /* ClockInit() only knows the user tick types. The functions of the default clock read the host counter inline, so the
+     fChronoClock_xxx() functions do the same when they are called with the default clock. */
+  _chrono._tickType = TICK_TYPE_HOST;
+#endif
+
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+  if(res == CHRONO_OK) {
+    OverheadInit(&_chrono);
+  }
+#endif
+
+  return res;
+}
+
+/**
+ * @brief Validates the configuration and initializes the clock with it.
+ * 
+ * @param clock Pointer to the clock object
+ * @param config Pointer to the configuration of the clock
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+static uint8_t ClockInit(sChronoClock * const clock, sChronoClockConfig const * const config) {
+
+  clock->_init = FALSE;
+
+  if(config->TickTopValue == 0U) {
+    return CHRONO_ERROR_TICK_TOP_ZERO;      /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if((config->TickPeriodNum == 0U) || (config->TickPeriodDen == 0U)) {
+    return CHRONO_ERROR_TICK_TO_NS_ZERO;    /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(config->TickValue != NULL) {
+    clock->_tickType = TICK_TYPE_VARIABLE;
+  } else if(config->GetTickValue != NULL) {
+    clock->_tickType = TICK_TYPE_FUNCTION;
+  } else {
+    return CHRONO_ERROR_TICK_PTR_ERROR;     /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if((config->CounterMode != TICK_COUNTERMODE_UP) && (config->CounterMode != TICK_COUNTERMODE_DOWN)) {
+    return CHRONO_ERROR_COUNTERMODE;        /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  clock->_counterMode = config->CounterMode | (CHRONO_IS_TOP_MASK_(config->TickTopValue) ? CHRONO_COUNTERMODE_MASKED_ : 0U);
+  clock->_tickTopValue = config->TickTopValue;
+  clock->_tickToNsCoef = (config->TickPeriodNum / config->TickPeriodDen);
+  clock->_tickPeriodNum = config->TickPeriodNum;
+  clock->_tickPeriodDen = config->TickPeriodDen;
+  clock->_pTickValue = config->TickValue;
+  clock->_getTickValue = config->GetTickValue;
+
+  if(!InitScales(clock)) {
+    return CHRONO_ERROR_TICK_PERIOD_RANGE;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  clock->_tickInitValue = CHRONO_GET_TICK_(clock, clock->_tickType);
+  TimebaseInit(clock);
+  clock->_init = TRUE;
+
+  return CHRONO_OK;
 }
 
 /**
- * @brief Stops the chrono object to signal the end of time measurement.
+ * @brief Initializes the scales that convert ticks to time units and vice versa, based on the tick period ratio.
  * 
- * @note This function stops the chrono object and puts it in the stop state. Measurements are not valid in this case, and corresponding functions return 0.
- * 
- * @param me Pointer to the chrono object
+ * @param clock Pointer to the clock object
+ * @retval isValid: FALSE if one of the ratios can't be represented with 32-bit numerator and denominator.
  */
-void fChrono_Stop(sChrono * const me) {
-
-  ASSERT_(_chrono.Init);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_stopTick = GET_TICK_();
-  me->_run = FALSE;
-  me->_isTimeout = FALSE;
+static bool_t InitScales(sChronoClock * const clock) {
+
+  uint64_t num = clock->_tickPeriodNum;
+  uint64_t den = clock->_tickPeriodDen;
+  bool_t isValid = TRUE;
+
+  isValid = ScaleInit(&clock->_tickToUs, num, den * 1000U) && isValid;
+  isValid = ScaleInit(&clock->_tickToMs, num, den * 1000000U) && isValid;
+  isValid = ScaleInit(&clock->_tickToS, num, den * 1000000000U) && isValid;
+  isValid = ScaleInit(&clock->_usToTick, den * 1000U, num) && isValid;
+  isValid = ScaleInit(&clock->_msToTick, den * 1000000U, num) && isValid;
+  isValid = ScaleInit(&clock->_sToTick, den * 1000000000U, num) && isValid;
+  isValid = ScaleInit(&clock->_tickToNs, num, den) && isValid;
+  isValid = ScaleInit(&clock->_nsToTick, den, num) && isValid;
+
+  /* The conditions are compile-time constants, so builds with integral time types don't contain floating point code. */
+  if(!CHRONO_IS_INTEGRAL_TYPE_(timeUs_t)) {
+    ScaleRatioInit(&clock->_tickToUs, (sizeof(timeUs_t) == sizeof(float)), FALSE);
+    ScaleRatioInit(&clock->_usToTick, (sizeof(timeUs_t) == sizeof(float)), TRUE);
+  }
+  if(!CHRONO_IS_INTEGRAL_TYPE_(timeMs_t)) {
+    ScaleRatioInit(&clock->_tickToMs, (sizeof(timeMs_t) == sizeof(float)), FALSE);
+    ScaleRatioInit(&clock->_msToTick, (sizeof(timeMs_t) == sizeof(float)), TRUE);
+  }
+  if(!CHRONO_IS_INTEGRAL_TYPE_(timeS_t)) {
+    ScaleRatioInit(&clock->_tickToS, (sizeof(timeS_t) == sizeof(float)), FALSE);
+    ScaleRatioInit(&clock->_sToTick, (sizeof(timeS_t) == sizeof(float)), TRUE);
+  }
 
+  return isValid;
 }
 
 /**
- * @brief Returns the elapsed time in seconds since the start of the measurement using fChrono_Start().
+ * @brief Computes the fixed-point constants of a scale that converts a quantity with the ratio num/den.
  * 
- * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * @note The ratio is first reduced by the greatest common divisor of num and den.
+ *       With Shift = 32 + ceil(log2(den)) and Mul = ceil(2^Shift * num / den), the error of (ticks * Mul) >> Shift is smaller than
+ *       one unit of the result for every 32-bit input, so it equals floor(ticks * num / den).
+ *       This condition holds as long as the reduced num is smaller than 2^31.
  * 
- * @param me Pointer to the chrono object
- * @retval elapsed: Elapsed time since starting the chrono object (seconds)
+ * @note If the reduced num or den doesn't fit in 32 bits, e.g., the seconds of a clock faster than 4.29 GHz, Mul and Shift aren't computed
+ *       and ChronoScaleApply() always divides. The ratio is still valid while num * den fits in 64 bits, because the division computes (n % den) * num.
+ * 
+ * @note This function is only called from fChrono_Init() and fChronoClock_Init(), so the divisions below are not on the hot path.
+ * 
+ * @param me Pointer to the scale object
+ * @param num Numerator of the conversion ratio
+ * @param den Denominator of the conversion ratio
+ * @retval isValid: FALSE if num * den of the reduced ratio doesn't fit in 64 bits.
  */
-timeS_t fChrono_ElapsedS(sChrono const * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitSec, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
+static bool_t ScaleInit(sChronoScale * const me, uint64_t num, uint64_t den) {
 
-  if(!me->_run) {
-    return TIMESPAN_S_(me->_startTick, me->_stopTick); /* MISRA 2012 Rule 15.5 deviation */
+  me->_num = 0U;
+  me->_den = 1U;
+  me->_mul = 0U;
+  me->_wide = 0U;
+  me->_shift = 32U;
+  me->_ratio._d = 0.0;
+
+  if((den == 0U) || (num == 0U)) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
   }
-  
-  tick_t currentTick = GET_TICK_();
-  return (timeS_t)((timeS_t)(ELAPSED_(currentTick, me->_startTick)) / _chrono.SecToTickCoef);
+
+  uint64_t a = num;
+  uint64_t b = den;
+  while(b != 0U) {
+    uint64_t r = a % b;
+    a = b;
+    b = r;
+  }
+  num /= a;
+  den /= a;
+
+  if(num > (UINT64_MAX / den)) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->_num = num;
+  me->_den = den;
+
+  if((num > (uint64_t)UINT32_MAX) || (den > (uint64_t)UINT32_MAX)) {
+    me->_wide = (uint64_t)1U << 32;
+    return TRUE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint8_t log2Den = 0U;
+  while((log2Den < 32U) && (((uint64_t)1U << log2Den) < (uint64_t)den)) {
+    log2Den++;
+  }
+
+  while((log2Den > 0U) && ((((uint64_t)num << log2Den) / den) > (uint64_t)UINT32_MAX)) {
+    log2Den--;
+  }
+
+  uint64_t x = (uint64_t)num << log2Den;
+  uint64_t quotient = x / den;
+  uint64_t remainder = (x % den) << 32;
+  uint64_t fraction = (remainder / den) + (((remainder % den) != 0U) ? 1U : 0U);
+
+  me->_mul = (quotient << 32) + fraction;
+  me->_shift = (uint8_t)(32U + log2Den);
+
+  return TRUE;
 }
 
 /**
- * @brief Returns the elapsed time in milliseconds since the start of the measurement using fChrono_Start().
+ * @brief Computes the ratio of a scale whose time unit is a floating point type, so the conversion is one multiplication.
  * 
- * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * @note The ratio of the scales that convert time to ticks is rounded up by one step of its precision.
+ *       Otherwise a time that is an exact number of ticks could give a product just below it, which is truncated to the tick before.
  * 
- * @param me Pointer to the chrono object
- * @retval elapsed: Elapsed time since starting the chrono object (milliseconds)
+ * @note The function is inline, so builds with integral time types don't contain it even without optimization.
+ * 
+ * @param me Pointer to the scale object. ScaleInit() must be called before.
+ * @param isFloat TRUE if the time unit is float, FALSE if it is double or long double.
+ * @param isToTick TRUE if the scale converts time to ticks.
  */
-timeMs_t fChrono_ElapsedMs(sChrono const * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitMs, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
-  
-  if(!me->_run) {
-    return TIMESPAN_MS_(me->_startTick, me->_stopTick); /* MISRA 2012 Rule 15.5 deviation */
+static inline void ScaleRatioInit(sChronoScale * const me, bool_t isFloat, bool_t isToTick) {
+
+  if(isFloat) {
+    float ratio = (float)me->_num / (float)me->_den;
+    me->_ratio._f = isToTick ? (ratio * (1.0f + FLT_EPSILON)) : ratio;
+  } else {
+    double ratio = (double)me->_num / (double)me->_den;
+    me->_ratio._d = isToTick ? (ratio * (1.0 + DBL_EPSILON)) : ratio;
   }
-  
-  tick_t currentTick = GET_TICK_();
-  return (timeMs_t)((timeMs_t)(ELAPSED_(currentTick, me->_startTick)) / _chrono.MsToTickCoef);
 }
 
 /**
- * @brief Returns the elapsed time in microseconds since the start of the measurement using fChrono_Start().
- * 
- * @note fChrono_Start() must be called before using this function. It returns the time passed since the start.
+ * @brief Resets the 64-bit timebase of the clock to zero at its initial tick.
  * 
- * @param me Pointer to the chrono object
- * @retval elapsed: Elapsed time since starting the chrono object (microseconds)
+ * @param clock Pointer to the clock object
  */
-timeUs_t fChrono_ElapsedUs(sChrono const * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitUs, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+static void TimebaseInit(sChronoClock * const clock) {
+
+  uint8_t i;
 
-  if(!me->_run) {
-    return TIMESPAN_US_(me->_startTick, me->_stopTick); /* MISRA 2012 Rule 15.5 deviation */
+  for(i = 0U; i < 2U; i++) {
+    clock->_timebase._slot[i]._ticks = 0U;
+    clock->_timebase._slot[i]._lastTick = clock->_tickInitValue;
   }
-  
-  tick_t currentTick = GET_TICK_();
-  return (timeUs_t)((timeUs_t)(ELAPSED_(currentTick, me->_startTick)) / _chrono.UsToTickCoef);
+  clock->_timebase._seq = 0U;
+
+  CHRONO_TIMEBASE_BARRIER_();
 }
 
 /**
- * @brief Returns the remaining time in seconds until the chrono object reaches its timeout.
- * 
- * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
- * 
- * @note This function works correctly if a timeout has occurred, returning zero in that case.
- *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
- * 
- * @param me Pointer to the chrono object
- * @retval timeLeft: Time length until timeout (seconds)
+ * @brief Measures the frequency of the clock against the reference and applies it to the clock.
+ * 
+ * @note The frequency is ticks * 1e9 / referenceNs, rounded to 1 Hz. The tick period becomes 1e9 / frequency ns, so the scales of the clock
+ *       are always representable (see ScaleInit()). Above 4.29 GHz, the period is reduced to fit in 32 bits, e.g., 2 / 9 ns for 4.5 GHz.
+ *       The error bound is half the width of the two edges in ticks, relative to the ticks of the window, plus the rounding of the frequency
+ *       and of the reduced period.
+ * 
+ * @param clock Pointer to the clock object that is calibrated
+ * @param reference Pointer to the reference clock
+ * @param windowNs Length of the measurement window in nanoseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval calibrationStatus: returns CHRONO_OK if successful, otherwise the error code.
  */
-timeS_t fChrono_LeftS(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitSec, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
+static chrono_res_t ClockCalibrate(sChronoClock * const clock, sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result) {
 
-  if(!me->_run) {
-    return (timeS_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  if((windowNs == 0U) || (windowNs > CALIBRATION_MAX_WINDOW_NS_)) {
+    return CHRONO_ERROR_CALIBRATION; /* MISRA 2012 Rule 15.5 deviation */
   }
-  
-  if(me->_isTimeout) {
-    return (timeS_t)0;
+
+  uint64_t windowTick = ChronoScaleApply(&reference->_nsToTick, windowNs);
+  if(windowTick == 0U) {
+    return CHRONO_ERROR_CALIBRATION; /* MISRA 2012 Rule 15.5 deviation */
   }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t elapsedTick = ELAPSED_(currentTick, me->_startTick);
-  timeS_t elapsed = (timeS_t)((timeS_t)(elapsedTick) / _chrono.SecToTickCoef);
-  if(elapsedTick >= (me->_timeout)) {
-    me->_isTimeout = TRUE;
-    return (timeS_t)0;
-  } else {
-    return ((me->_timeout / _chrono.SecToTickCoef) - elapsed);
+
+  uint64_t startEdge;
+  uint64_t startWidth;
+  uint64_t endEdge;
+  uint64_t endWidth;
+  uint64_t startTick = CalibrationEdge(clock, reference, 0U, &startEdge, &startWidth);
+  uint64_t endTick = CalibrationEdge(clock, reference, (startEdge + windowTick) - 1U, &endEdge, &endWidth);
+
+  sChronoCalibration calibration;
+  calibration.Ticks = endTick - startTick;
+  calibration.ReferenceNs = ChronoScaleApply(&reference->_tickToNs, endEdge - startEdge);
+  if((calibration.Ticks == 0U) || (calibration.ReferenceNs == 0U)) {
+    return CHRONO_ERROR_CALIBRATION; /* MISRA 2012 Rule 15.5 deviation */
   }
-}
 
-/**
- * @brief Returns the remaining time in milliseconds until the chrono object reaches its timeout.
- * 
- * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
- * 
- * @note This function works correctly if a timeout has occurred, returning zero in that case.
- *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
- * 
- * @param me Pointer to the chrono object
- * @retval timeLeft: Time length until timeout (milliseconds)
- */
-timeMs_t fChrono_LeftMs(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitMs, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+  uint64_t frequency = MulDivRound(calibration.Ticks, 1000000000U, calibration.ReferenceNs);
+  if(frequency == 0U) {
+    return CHRONO_ERROR_CALIBRATION; /* MISRA 2012 Rule 15.5 deviation */
+  }
 
-  if(!me->_run) {
-    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  uint64_t errorPpm = MulDivRound(startWidth + endWidth, 500000U, calibration.Ticks) + 1U;
+  errorPpm += (500000U + frequency - 1U) / frequency;
+
+  /* The tick period 1e9 / frequency ns is reduced to a ratio of two 32-bit integers. Above 4.29 GHz, the frequency
+     doesn't fit, so the ratio is reduced by its gcd and, if it still doesn't fit, by 2 or 5 with the denominator rounded. */
+  uint64_t num = 1000000000U;
+  uint64_t den = frequency;
+  if(den > (uint64_t)UINT32_MAX) {
+    uint64_t gcd = Gcd(num, den);
+    num /= gcd;
+    den /= gcd;
+    while((den > (uint64_t)UINT32_MAX) && (num > 1U)) {
+      uint64_t divisor = ((num % 2U) == 0U) ? 2U : 5U;
+      num /= divisor;
+      den = (den + (divisor / 2U)) / divisor;
+    }
+    if(den > (uint64_t)UINT32_MAX) {
+      return CHRONO_ERROR_CALIBRATION; /* MISRA 2012 Rule 15.5 deviation */
+    }
+    errorPpm += (500000U + den - 1U) / den;
   }
-  
-  if(me->_isTimeout) {
-    return (timeMs_t)0;
+
+  calibration.FrequencyHz = frequency;
+  calibration.ErrorPpm = (errorPpm > (uint64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)errorPpm;
+
+  uint32_t periodNum = clock->_tickPeriodNum;
+  uint32_t periodDen = clock->_tickPeriodDen;
+  clock->_tickPeriodNum = (uint32_t)num;
+  clock->_tickPeriodDen = (uint32_t)den;
+  if(!InitScales(clock)) {
+    clock->_tickPeriodNum = periodNum;
+    clock->_tickPeriodDen = periodDen;
+    (void)InitScales(clock);
+    return CHRONO_ERROR_TICK_PERIOD_RANGE; /* MISRA 2012 Rule 15.5 deviation */
   }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t elapsedTick = ELAPSED_(currentTick, me->_startTick);
-  timeMs_t elapsed = (timeMs_t)((timeMs_t)(elapsedTick) / _chrono.MsToTickCoef);
-  if(elapsedTick >= (me->_timeout)) {
-    me->_isTimeout = TRUE;
-    return (timeMs_t)0;
-  } else {
-    return ((me->_timeout / _chrono.MsToTickCoef) - elapsed);
+  clock->_tickToNsCoef = clock->_tickPeriodNum / clock->_tickPeriodDen;
+
+  if(result != NULL) {
+    *result = calibration;
   }
+
+  return CHRONO_OK;
 }
 
 /**
- * @brief Returns the remaining time in microseconds until the chrono object reaches its timeout.
- * 
- * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
- * 
- * @note This function works correctly if a timeout has occurred, returning zero in that case.
- *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * @brief Waits until the reference clock passes a tick and returns the 64-bit tick of the clock at that edge.
+ * 
+ * @note The edge happened after the reference read before the last one, so it lies between the clock read before that one and
+ *       the clock read after the last one. The middle of this range is returned and its width is the uncertainty of the edge.
+ *       If the reference has already passed "referenceTick" at the first read, the function waits for the next edge, so the range is always valid.
+ * 
+ * @param clock Pointer to the clock object that is calibrated
+ * @param reference Pointer to the reference clock
+ * @param referenceTick The function returns when the 64-bit tick of the reference is greater than this tick
+ * @param edgeTick Pointer to the 64-bit tick of the reference after the edge
+ * @param width Pointer to the width of the range of the edge, in ticks of the clock
+ * @retval tick64: 64-bit tick of the clock at the edge
+ */
+static uint64_t CalibrationEdge(sChronoClock const * const clock, sChronoClock const * const reference, uint64_t referenceTick, uint64_t * const edgeTick, uint64_t * const width) {
+
+  uint64_t before = ChronoClockTick64(CHRONO_CLOCK_(clock));
+  uint64_t previous;
+  uint64_t tick = ChronoClockTick64(CHRONO_CLOCK_(reference));
+  uint64_t waitTick = (tick > referenceTick) ? tick : referenceTick;
+
+  do {
+    previous = before;
+    before = ChronoClockTick64(CHRONO_CLOCK_(clock));
+    tick = ChronoClockTick64(CHRONO_CLOCK_(reference));
+  } while(tick <= waitTick);
+
+  uint64_t after = ChronoClockTick64(CHRONO_CLOCK_(clock));
+
+  *edgeTick = tick;
+  *width = after - previous;
+
+  return previous + ((after - previous) / 2U);
+}
+
+/**
+ * @brief Returns the greatest common divisor of two integers.
  * 
- * @param me Pointer to the chrono object
- * @retval timeLeft: Time length until timeout (microseconds)
+ * @retval gcd: Greatest common divisor of a and b
  */
-timeUs_t fChrono_LeftUs(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitUs, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+static uint64_t Gcd(uint64_t a, uint64_t b) {
 
-  if(!me->_run) {
-    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
-  }
-  
-  if(me->_isTimeout) {
-    return (timeUs_t)0;
-  }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t elapsedTick = ELAPSED_(currentTick, me->_startTick);
-  timeUs_t elapsed = (timeUs_t)((timeUs_t)(elapsedTick) / _chrono.UsToTickCoef);
-  if(elapsedTick >= (me->_timeout)) {
-    me->_isTimeout = TRUE;
-    return (timeUs_t)0;
-  } else {
-    return ((me->_timeout / _chrono.UsToTickCoef) - elapsed);
+  while(b != 0U) {
+    uint64_t r = a % b;
+    a = b;
+    b = r;
   }
+
+  return a;
 }
 
 /**
- * @brief Starts the chrono object in timeout mode.
+ * @brief Returns a * b / c rounded to the nearest integer, without the overflow of a * b.
  * 
- * @param me Pointer to the chrono object
- * @param timeout Time length until the chrono object times out (seconds)
+ * @note (a % c) * b must fit in 64 bits. With b = 1e9 it holds for c up to 1.8e10, which CALIBRATION_MAX_WINDOW_NS_ ensures.
+ * 
+ * @retval result: a * b / c
  */
-void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout) {
+static uint64_t MulDivRound(uint64_t a, uint64_t b, uint64_t c) {
 
-  ASSERT_(_chrono.InitSec); /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me);     /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_timeout = (tick_t)(timeout * (timeS_t)_chrono.SecToTickCoef);
-  me->_isTimeout = FALSE;
-  
-  START_(me);
+  return ((a / c) * b) + ((((a % c) * b) + (c / 2U)) / c);
 }
 
 /**
- * @brief Starts the chrono object in timeout mode.
+ * @brief Waits until the specified number of ticks passes since the start tick.
  * 
- * @param me Pointer to the chrono object
- * @param timeout Time length until the chrono object times out (milliseconds)
+ * @note If CHRONO_OVERHEAD_COMPENSATION is defined, the fixed cost of a delay call is subtracted from the delay.
+ *       If CHRONO_DELAY_SLEEP is defined, the delay first sleeps until the time left is within the spin window.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param startTick Start tick of the delay
+ * @param delayTick Delay time length (ticks)
  */
-void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout) {
+static inline void DelayTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, chronoTick_t startTick, chronoTick_t delayTick) {
 
-  ASSERT_(_chrono.Init);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me);   /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_timeout = (tick_t)(timeout * (timeMs_t)_chrono.MsToTickCoef);
-  me->_isTimeout = FALSE;
-  
-  START_(me);
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+  delayTick = (delayTick > clock->_delayOverhead) ? (chronoTick_t)(delayTick - clock->_delayOverhead) : (chronoTick_t)0U;
+#endif
+
+#ifdef CHRONO_DELAY_SLEEP
+  DelaySleep(clock, type, mode, startTick, delayTick);
+#endif
+
+  ChronoClockDelayTick(clock, type, mode, startTick, delayTick);
 }
 
 /**
- * @brief Starts the chrono object in timeout mode.
+ * @brief Waits for the specified number of ticks, in parts of at most half of the tick range.
  * 
- * @param me Pointer to the chrono object
- * @param timeout Time length until the chrono object times out (microseconds)
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param delayTick Delay time length (ticks)
  */
-void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout) {
+static void DelayTicks(sChronoClock const * const clock, uint8_t type, uint8_t mode, uint64_t delayTick) {
 
-  ASSERT_(_chrono.InitUs);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me);     /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_timeout = (tick_t)(timeout * (timeUs_t)_chrono.UsToTickCoef);
-  me->_isTimeout = FALSE;
-  
-  START_(me);
+#ifndef CHRONO_TICK_EXTENSION
+  uint64_t part = (clock->_tickTopValue > 1U) ? ((uint64_t)clock->_tickTopValue / 2U) : 1U;
+  while(delayTick > part) {
+    DelayTick(clock, type, mode, ChronoClockNow(clock, type, mode), (chronoTick_t)part);
+    delayTick -= part;
+  }
+#endif
+
+  DelayTick(clock, type, mode, ChronoClockNow(clock, type, mode), (chronoTick_t)delayTick);
 }
 
+#ifdef CHRONO_DELAY_SLEEP
 /**
- * @brief Returns the timeout status of the chrono object.
+ * @brief Sleeps until the time left of a delay is within the spin window.
  * 
- * @note Before using this function, ensure that fChrono_StartTimeoutS(), fChrono_StartTimeoutMs() or fChrono_StartTimeoutUs() has been called to start the measurement.
+ * @note Each sleep asks for the time left minus the spin window. A wake-up after the requested time updates the spin window with the lateness.
+ *       An early wake-up doesn't, the function just sleeps again.
  * 
- * @param me Pointer to the chrono object
- * @retval isTimeout: TRUE if the chrono is timed out, otherwise returns FALSE
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param startTick Start tick of the delay
+ * @param delayTick Delay time length (ticks)
  */
-bool_t fChrono_IsTimeout(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.Init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, FALSE);  /* MISRA 2012 Rule 15.5 deviation */
+static void DelaySleep(sChronoClock const * const clock, uint8_t type, uint8_t mode, chronoTick_t startTick, chronoTick_t delayTick) {
 
-  if(!me->_run) {
-    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
-  }
-  
-  tick_t startTick = me->_startTick;
-  
-  if(me->_isTimeout) {
-    return TRUE;
-  }
-  
-  tick_t currentTick = GET_TICK_();
-  if(ELAPSED_(currentTick, startTick) >= me->_timeout) {
-    me->_isTimeout = TRUE;
-  } else {
-    return FALSE;
+  fpSleep_t sleep = _delaySleep;
+  if(sleep == NULL) {
+    return; /* MISRA 2012 Rule 15.5 deviation */
   }
 
-  return TRUE;
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  chronoTick_t elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, startTick);
+
+  while(elapsedTick < delayTick) {
+
+    uint64_t leftNs = CHRONO_TICK_TO_NS_(clock, delayTick - elapsedTick);
+    uint64_t windowNs = _delaySpinWindowNs;
+    if(leftNs <= windowNs) {
+      break;
+    }
+
+    uint64_t sleepNs = leftNs - windowNs;
+    sleep(sleepNs);
+
+    chronoTick_t wakeTick = ChronoClockNow(clock, type, mode);
+    uint64_t sleptNs = CHRONO_TICK_TO_NS_(clock, CHRONO_OBJ_ELAPSED_(clock, mode, wakeTick, currentTick));
+    if(sleptNs > sleepNs) {
+      DelaySpinWindowUpdate(sleptNs - sleepNs);
+    }
+
+    currentTick = wakeTick;
+    elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, startTick);
+  }
 }
 
 /**
- * @brief Returns the time interval in seconds between two consecutive calls to this function.
- * 
- * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
- *       between the current tick and the last time fChrono_IntervalS() was called.
- *
- * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalS() function calls.
+ * @brief Updates the spin window with the latency of a late wake-up.
  * 
- * @note A practical use case is measuring the time interval during the execution of a periodic function.
- *       By invoking fChrono_IntervalS() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * @note The target is the latency plus 25%. The window moves halfway up to a larger target, so one long preemption doesn't make every
+ *       later delay spin, and 1/16 of the way down to a smaller one.
  * 
- * @param me Pointer to the chrono object
- * @retval interval: Time interval between two consecutive calls of the function (seconds)
+ * @param latencyNs Time between the requested and the actual end of the sleep (nanoseconds)
  */
-timeS_t fChrono_IntervalS(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitSec, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
+static void DelaySpinWindowUpdate(uint64_t latencyNs) {
 
-  if(!me->_run) {
-    return (timeS_t)0;  /* MISRA 2012 Rule 15.5 deviation */
+  uint64_t targetNs = latencyNs + (latencyNs >> 2);
+  uint64_t windowNs = _delaySpinWindowNs;
+
+  if(targetNs >= windowNs) {
+    windowNs += (targetNs - windowNs) >> 1;
+  } else {
+    windowNs -= (windowNs - targetNs) >> 4;
   }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t startTick = me->_startTick;
-  me->_startTick = currentTick;
-  
-  return ((timeS_t)(ELAPSED_(currentTick, startTick)) / _chrono.SecToTickCoef);
+
+  if(windowNs > CHRONO_DELAY_SPIN_MAX_NS) {
+    windowNs = CHRONO_DELAY_SPIN_MAX_NS;
+  } else if(windowNs < DELAY_SPIN_MIN_NS_) {
+    windowNs = DELAY_SPIN_MIN_NS_;
+  } else {
+    /* The window is in range. */
+  }
+
+  _delaySpinWindowNs = (uint32_t)windowNs;
 }
+#endif
 
+#ifdef CHRONO_OVERHEAD_COMPENSATION
 /**
- * @brief Returns the time interval in milliseconds between two consecutive calls to this function.
+ * @brief Measures the fixed cost of a start/elapsed measurement and of a delay on the clock.
  * 
- * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
- *       between the current tick and the last time fChrono_IntervalMs() was called.
- *
- * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalMs() function calls.
+ * @note The measurement goes through the same functions that the application calls: the fChrono_xxx() functions for the default clock
+ *       (inline with CHRONO_INLINE) and the fChronoClock_xxx() functions for the other clocks. The shortest of OVERHEAD_RUNS_ runs is kept.
  * 
- * @note A practical use case is measuring the time interval during the execution of a periodic function.
- *       By invoking fChrono_IntervalMs() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * @note The delay is bracketed by two tick reads, so the ticks of two back-to-back reads are subtracted from it.
  * 
- * @param me Pointer to the chrono object
- * @retval interval: Time interval between two consecutive calls of the function (milliseconds)
+ * @param clock Pointer to the clock object. It must be initialized.
  */
-timeMs_t fChrono_IntervalMs(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitMs, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeMs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+static void OverheadInit(sChronoClock * const clock) {
+
+  sChrono chrono;
+  chronoTick_t elapsedMin = (chronoTick_t)~(chronoTick_t)0U;
+  chronoTick_t delayMin = (chronoTick_t)~(chronoTick_t)0U;
+  chronoTick_t bracketMin = (chronoTick_t)~(chronoTick_t)0U;
+  uint32_t i;
+
+  clock->_elapsedOverhead = 0U;
+  clock->_delayOverhead = 0U;
+
+  for(i = 0U; i < OVERHEAD_RUNS_; i++) {
+
+    chronoTick_t elapsedTick;
+    if(clock == &_chrono) {
+      fChrono_Start(&chrono);
+      elapsedTick = (chronoTick_t)fChrono_ElapsedTick(&chrono);
+    } else {
+      fChronoClock_Start(clock, &chrono);
+      elapsedTick = (chronoTick_t)fChronoClock_ElapsedTick(clock, &chrono);
+    }
 
-  if(!me->_run) {
-    return (timeMs_t)0; /* MISRA 2012 Rule 15.5 deviation */
+    chronoTick_t startTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+    chronoTick_t endTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+    chronoTick_t bracketTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, clock->_counterMode, endTick, startTick);
+
+    startTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+    if(clock == &_chrono) {
+      fChrono_DelayUs(0U);
+    } else {
+      fChronoClock_DelayUs(clock, 0U);
+    }
+    endTick = ChronoClockNow(CHRONO_CLOCK_(clock));
+    chronoTick_t delayTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, clock->_counterMode, endTick, startTick);
+
+    elapsedMin = (elapsedTick < elapsedMin) ? elapsedTick : elapsedMin;
+    bracketMin = (bracketTick < bracketMin) ? bracketTick : bracketMin;
+    delayMin = (delayTick < delayMin) ? delayTick : delayMin;
   }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t startTick = me->_startTick;
-  me->_startTick = currentTick;
-  
-  return ((timeMs_t)(ELAPSED_(currentTick, startTick)) / _chrono.MsToTickCoef);
+
+  clock->_elapsedOverhead = elapsedMin;
+  clock->_delayOverhead = (delayMin > bracketMin) ? (chronoTick_t)(delayMin - bracketMin) : (chronoTick_t)0U;
 }
+#endif
 
+#ifdef HOST_DELAY_SLEEP_
 /**
- * @brief Returns the time interval in microseconds between two consecutive calls to this function.
- * 
- * @note Before using this function, ensure that fChrono_Start() has been called first. Whenever this function is called, it measures the interval
- *       between the current tick and the last time fChrono_IntervalUs() was called.
- *
- * @note For the first call, it measures the interval between fChrono_Start() and the first fChrono_IntervalUs() function calls.
+ * @brief Sleeps on CLOCK_MONOTONIC for the specified time. It is the default sleep function of the delays with TICK_TYPE_HOST.
  * 
- * @note A practical use case is measuring the time interval during the execution of a periodic function.
- *       By invoking fChrono_IntervalUs() at the beginning of the periodic function, you can accurately measure the interval between consecutive runs.
+ * @note If a signal interrupts the sleep, the function returns early and the delay sleeps again.
  * 
- * @param me Pointer to the chrono object
- * @retval interval: Time interval between two consecutive calls of the function (microseconds)
+ * @param sleepNs Sleep time length (nanoseconds)
  */
-timeUs_t fChrono_IntervalUs(sChrono * const me) {
-  
-  ASSERT_RETURN_(_chrono.InitUs, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RETURN_(me, (timeUs_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+static void HostSleep(uint64_t sleepNs) {
 
-  if(!me->_run) {
-    return (timeUs_t)0; /* MISRA 2012 Rule 15.5 deviation */
-  }
-  
-  tick_t currentTick = GET_TICK_();
-  tick_t startTick = me->_startTick;
-  me->_startTick = currentTick;
-  
-  return ((timeUs_t)(ELAPSED_(currentTick, startTick)) / _chrono.UsToTickCoef);
+  struct timespec ts;
+  ts.tv_sec = (time_t)(sleepNs / 1000000000U);
+  ts.tv_nsec = (long)(sleepNs % 1000000000U);
+
+  (void)clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
 }
+#endif
 
-/** @} */ //End of OBJECTIVE_API
+#ifdef HOST_CALIBRATION_
+/**
+ * @brief Returns CLOCK_MONOTONIC in nanoseconds. It is the reference clock of fChrono_InitCalibrated().
+ * 
+ * @retval tick: CLOCK_MONOTONIC in nanoseconds
+ */
+static tick_t HostReferenceTick(void) {
 
-/*
-╔══════════════════════════════════════════════════════════════════════════════════╗
-║                            ##### Private Functions #####                         ║
-╚══════════════════════════════════════════════════════════════════════════════════╝
-*/
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
 
+  return (tick_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+#endif
 
 /************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -50,6 +50,21 @@ typedef uint8_t chrono_res_t;
 #define CHRONO_ERROR_TICK_TOP_ZERO    (1U)
 #define CHRONO_ERROR_TICK_TO_NS_ZERO  (2U)
 #define CHRONO_ERROR_TICK_PTR_ERROR   (3U)
+#define CHRONO_ERROR_TICK_PERIOD_RANGE (4U)
+#define CHRONO_ERROR_COUNTERMODE      (5U)
+#define CHRONO_ERROR_CALIBRATION      (6U)
+
+/**
+ * @brief Overrun policies of fChrono_IsPeriodDue(). They select what happens to the periods that are missed when a periodic chrono object is polled late.
+ * 
+ * @note CHRONO_OVERRUN_CATCH_UP: The function returns TRUE once for every period, so the missed periods run back to back until the object catches up.
+ *       CHRONO_OVERRUN_SKIP: The function returns TRUE once and the missed periods are dropped. The next period starts on the original phase.
+ *       CHRONO_OVERRUN_COALESCE: The function returns TRUE once and the next period starts from the current tick, so the phase moves by the lateness.
+ * 
+ */
+#define CHRONO_OVERRUN_CATCH_UP       (0U)
+#define CHRONO_OVERRUN_SKIP           (1U)
+#define CHRONO_OVERRUN_COALESCE       (2U)
 
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup TIME_MACROS Time macros
@@ -64,22 +79,19 @@ typedef uint8_t chrono_res_t;
 
 /**
  * @brief Returns the number of microseconds passed since the initialization of the chrono module.
- * @note This macro is not re-entrant. if this condition may be happen, user should use critical section
- *       for prevent it.
+ * @note This macro is re-entrant and can be called from interrupts and threads without a critical section.
  */
 #define micros_()	fChrono_GetContinuousTickUs()
 
 /**
  * @brief Returns the number of milliseconds passed since the initialization of the chrono module.
- * @note This macro is not re-entrant. if this condition may be happen, user should use critical section
- *       for prevent it.
+ * @note This macro is re-entrant and can be called from interrupts and threads without a critical section.
  */
 #define millis_()	fChrono_GetContinuousTickMs()
 
 /**
  * @brief Returns the number of seconds passed since the initialization of the chrono module.
- * @note This macro is not re-entrant. if this condition may be happen, user should use critical section
- *       for prevent it.
+ * @note This macro is re-entrant and can be called from interrupts and threads without a critical section.
  */
 #define seconds_()	fChrono_GetContinuousTickS()
 
@@ -115,6 +127,51 @@ typedef uint8_t chrono_res_t;
 
 /** @} */ //End of TIME_MACROS
 
+/** @defgroup SPIN_MACROS Busy-wait macros
+ *  @{
+ */
+
+/**
+ * @brief Tells the CPU that the caller is in a busy-wait loop: "pause" on x86 and "yield" on arm. It is empty on other targets.
+ * 
+ * @note It can be used as CHRONO_SPIN_HINT() in chrono_config.h.
+ * 
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define CHRONO_CPU_RELAX_() __asm__ __volatile__("pause")
+#elif defined(__GNUC__) && (defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+  #define CHRONO_CPU_RELAX_() __asm__ __volatile__("yield")
+#else
+  #define CHRONO_CPU_RELAX_()
+#endif
+
+/**
+ * @brief Waits between two tick reads of a busy-wait loop. "backoff_" is a uint32_t variable of the loop that starts at 1.
+ * 
+ * @note The wait is "backoff_" calls of CHRONO_SPIN_HINT(). After each wait "backoff_" doubles, up to CHRONO_SPIN_BACKOFF_MAX.
+ *       If CHRONO_SPIN_HINT() is not defined in chrono_config.h, there is no wait and the loop reads the tick as fast as it can.
+ * 
+ */
+#ifdef CHRONO_SPIN_HINT
+  #ifndef CHRONO_SPIN_BACKOFF_MAX
+    #define CHRONO_SPIN_BACKOFF_MAX (1U)
+  #endif
+  #define CHRONO_SPIN_WAIT_(backoff_) \
+    do { \
+      uint32_t spin_; \
+      for(spin_ = 0U; spin_ < (backoff_); spin_++) { \
+        CHRONO_SPIN_HINT(); \
+      } \
+      if((backoff_) < (CHRONO_SPIN_BACKOFF_MAX)) { \
+        (backoff_) <<= 1U; \
+      } \
+    } while(0)
+#else
+  #define CHRONO_SPIN_WAIT_(backoff_) ((void)(backoff_))
+#endif
+
+/** @} */ //End of SPIN_MACROS
+
 /* Exported types ------------------------------------------------------------*/
 /**
   * @brief Definition of bool_t for misra compliance.
@@ -135,6 +192,18 @@ typedef bool bool_t;
 
 #endif  //bool_t
 
+/**
+  * @brief Tick type that the chrono objects use.
+  * 
+  * @note If CHRONO_TICK_EXTENSION is defined, it is the 64-bit tick of the clock and never overflows. Otherwise it is the raw tick.
+  * 
+  */
+#ifdef CHRONO_TICK_EXTENSION
+typedef uint64_t chronoTick_t;
+#else
+typedef tick_t chronoTick_t;
+#endif
+
 /**
   * @brief Definition of the Chrono object.
   * 
@@ -147,19 +216,224 @@ typedef struct {
                            When this parameter is false, the chrono is in stop mode, and time measurement functions will return 0.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
 
-  tick_t _startTick;  /*!< Holds the start time of the chrono.
+  chronoTick_t _startTick;  /*!< Holds the start time of the chrono.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
 
-  tick_t _stopTick;  /*!< Holds the stop time of the chrono.
+  chronoTick_t _stopTick;  /*!< Holds the stop time of the chrono.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
 
-  tick_t _timeout;    /*!< Holds the timeout length.
+  chronoTick_t _timeout;    /*!< Holds the timeout length.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
   
   bool_t _isTimeout;  /*!< Holds the timeout state of the chrono object.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
 }sChrono;
 
+/**
+  * @brief Definition of the Deadline object.
+  * 
+  * @note A deadline object is a timeout that stores its expiry tick instead of its length. The expiry tick is computed once when the deadline starts,
+  *       so checking the timeout only compares the current tick with the stored ticks and doesn't compute the elapsed ticks on every poll.
+  * 
+  */
+typedef struct {
+
+  bool_t _run;              /*!< Holds the RUN state of the deadline object. This parameter is private. */
+
+  bool_t _isTimeout;        /*!< Holds the timeout state of the deadline object. This parameter is private. */
+
+  bool_t _wrap;             /*!< TRUE if the tick generator overflows before the expiry tick. This parameter is private. */
+
+  chronoTick_t _startTick;  /*!< Holds the start tick of the deadline object. This parameter is private. */
+
+  chronoTick_t _deadline;   /*!< Holds the expiry tick of the deadline object. This parameter is private. */
+}sChronoDeadline;
+
+/**
+  * @brief Definition of the Compact object.
+  * 
+  * @note A compact object is a timeout for applications that keep a very large number of timeouts. The RUN and timeout states are folded into
+  *       the two most significant bits of a tick field, so the object has no bool_t fields and no padding.
+  *       Without CHRONO_TICK_EXTENSION it holds the start tick and the timeout (two tick_t). With CHRONO_TICK_EXTENSION the tick doesn't overflow,
+  *       so it only holds the expiry tick (one uint64_t).
+  * 
+  * @note The flags take two bits from the timeout (or the expiry tick), so the longest timeout is a quarter of the range of the tick field
+  *       (2^30 - 1 ticks for a 32-bit tick). The start functions reject longer timeouts.
+  * 
+  */
+typedef struct {
+
+#ifdef CHRONO_TICK_EXTENSION
+  chronoTick_t _deadline;   /*!< Holds the expiry tick and the flags of the compact object. This parameter is private. */
+#else
+  chronoTick_t _startTick;  /*!< Holds the start tick of the compact object. This parameter is private. */
+
+  chronoTick_t _timeout;    /*!< Holds the timeout length and the flags of the compact object. This parameter is private. */
+#endif
+}sChronoCompact;
+
+/**
+  * @brief Pointer to the function that returns the current tick.
+  * 
+  */
+typedef tick_t(*fpTick_t)(void);
+
+/**
+  * @brief Pointer to the function that sleeps during a delay (see fChrono_SetDelaySleep()).
+  * 
+  * @note The function should sleep for about sleepNs nanoseconds. It may return earlier, e.g., on any interrupt, but should not return much later.
+  * 
+  */
+typedef void(*fpSleep_t)(uint64_t sleepNs);
+
+/**
+  * @brief Fixed-point constants that convert a quantity with the ratio Num/Den without division.
+  * 
+  * @note The conversion result is floor(n * Num / Den) and is computed as (n * Mul) >> Shift.
+  *       Shift is selected in a way that the result is exact for every 32-bit input.
+  *       A ratio whose Num or Den doesn't fit in 32 bits (e.g., ticks of a clock faster than 4.29 GHz to seconds) is always converted with a division.
+  *       Floating point time units are converted with one multiplication by the precomputed ratio instead.
+  * 
+  */
+typedef struct {
+
+  uint64_t _mul;    /*!< Fixed-point multiplier, ceil(2^Shift * Num / Den). This parameter is private. */
+
+  uint64_t _num;    /*!< Numerator of the conversion ratio. This parameter is private. */
+
+  uint64_t _den;    /*!< Denominator of the conversion ratio. This parameter is private. */
+
+  uint64_t _wide;   /*!< 2^32 if Num or Den doesn't fit in 32 bits, otherwise 0. It is ORed to the input, so such a ratio always takes the division. This parameter is private. */
+
+  uint8_t _shift;   /*!< Right shift applied to the product. It is always 32 or more. This parameter is private. */
+
+  union {
+    float _f;       /*!< Num / Den, if the time unit of the scale is float. */
+    double _d;      /*!< Num / Den, if the time unit of the scale is double or long double. */
+  } _ratio;         /*!< Ratio of the scale for floating point time units. It is zero for integral time units. This parameter is private. */
+}sChronoScale;
+
+/**
+  * @brief Configuration of a clock, used by fChronoClock_Init().
+  * 
+  * @note Set either TickValue or GetTickValue and leave the other one NULL.
+  * 
+  */
+typedef struct {
+
+  volatile tick_t *TickValue;     /*!< Pointer to the memory location that contains the tick value (TICK_TYPE_VARIABLE). */
+
+  fpTick_t GetTickValue;          /*!< Pointer to the function that returns the tick value (TICK_TYPE_FUNCTION). */
+
+  tick_t TickTopValue;            /*!< The top value that the tick generator can count upto. */
+
+  uint32_t TickPeriodNum;         /*!< Numerator of the tick period in nanoseconds. */
+
+  uint32_t TickPeriodDen;         /*!< Denominator of the tick period in nanoseconds. Use 1 for an integer tick period. */
+
+  uint8_t CounterMode;            /*!< TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN. */
+}sChronoClockConfig;
+
+/**
+  * @brief Result of the calibration of a clock, filled by fChrono_Calibrate() and fChronoClock_Calibrate().
+  * 
+  * @note The error covers the uncertainty of the two edges of the measurement window and the rounding of the frequency to 1 Hz.
+  *       The accuracy of the reference clock itself is not included.
+  * 
+  */
+typedef struct {
+
+  uint64_t FrequencyHz;           /*!< Measured frequency of the tick generator in Hz. The tick period of the clock is set to 1e9 / FrequencyHz ns. */
+
+  uint32_t ErrorPpm;              /*!< Estimated bound of the error of FrequencyHz in parts per million. */
+
+  uint64_t Ticks;                 /*!< Ticks of the calibrated clock that were counted during the measurement window. */
+
+  uint64_t ReferenceNs;           /*!< Length of the measurement window according to the reference clock, in nanoseconds. */
+}sChronoCalibration;
+
+/**
+  * @brief One snapshot of the 64-bit timebase of a clock.
+  * 
+  */
+typedef struct {
+
+  volatile uint64_t _ticks;     /*!< Ticks counted since the clock was initialized, at the moment of _lastTick. This parameter is private. */
+
+  volatile tick_t _lastTick;    /*!< Raw tick value of the snapshot. This parameter is private. */
+}sChronoTimebaseSlot;
+
+/**
+  * @brief Lock-free 64-bit timebase of a clock.
+  * 
+  * @note Readers use the slot selected by _seq and never wait for a writer. A writer fills the other slot and then advances _seq,
+  *       so the active slot is never modified. A reader retries only if a writer published a snapshot during its read.
+  *       The lowest bit of _seq is set while a writer is filling a slot, so a preempting writer skips its update instead of waiting.
+  * 
+  */
+typedef struct {
+
+  volatile uint32_t _seq;               /*!< Sequence number of the published snapshot. This parameter is private. */
+
+  sChronoTimebaseSlot _slot[2];         /*!< Double buffered snapshots. This parameter is private. */
+}sChronoTimebase;
+
+/**
+  * @brief Definition of the Clock object.
+  * 
+  * @note A clock binds the chrono API to one tick generator. The fChrono_xxx() functions use the default clock, which is configured in chrono_config.h.
+  *       Users of the fChronoClock_xxx() functions need to create a variable of type sChronoClock for each extra tick generator.
+  * 
+  * @note All parameters are private and are set by fChronoClock_Init(). Users must not change their values.
+  * 
+  */
+typedef struct {
+
+  bool_t _init;                 /*!< TRUE if the clock is initialized successfully. */
+
+  uint8_t _tickType;            /*!< TICK_TYPE_VARIABLE, TICK_TYPE_FUNCTION or TICK_TYPE_HOST (default clock only). */
+
+  uint8_t _counterMode;         /*!< TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN, with a flag if the top value is 2^n-1. */
+
+  tick_t _tickTopValue;         /*!< The tick top value. */
+
+  tick_t _tickInitValue;        /*!< The tick value when the clock was initialized. */
+
+  uint32_t _tickToNsCoef;       /*!< Integer part of the tick period in nanoseconds. */
+
+  uint32_t _tickPeriodNum;      /*!< Numerator of the tick period in nanoseconds. */
+
+  uint32_t _tickPeriodDen;      /*!< Denominator of the tick period in nanoseconds. */
+
+  sChronoScale _tickToUs;       /*!< Scale that converts ticks to microseconds. */
+
+  sChronoScale _tickToMs;       /*!< Scale that converts ticks to milliseconds. */
+
+  sChronoScale _tickToS;        /*!< Scale that converts ticks to seconds. */
+
+  sChronoScale _usToTick;       /*!< Scale that converts microseconds to ticks. */
+
+  sChronoScale _tickToNs;       /*!< Scale that converts ticks to nanoseconds. */
+
+  sChronoScale _nsToTick;       /*!< Scale that converts nanoseconds to ticks. */
+
+  sChronoScale _msToTick;       /*!< Scale that converts milliseconds to ticks. */
+
+  sChronoScale _sToTick;        /*!< Scale that converts seconds to ticks. */
+
+  volatile tick_t *_pTickValue; /*!< Pointer to the tick value in TICK_TYPE_VARIABLE mode. */
+
+  fpTick_t _getTickValue;       /*!< Pointer to the function that returns the tick value in TICK_TYPE_FUNCTION mode. */
+
+  sChronoTimebase _timebase;    /*!< Lock-free 64-bit tick count since the clock was initialized. */
+
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+  chronoTick_t _elapsedOverhead; /*!< Ticks of a measurement with nothing between the start and the elapsed functions. They are subtracted from the elapsed ticks. */
+
+  chronoTick_t _delayOverhead;  /*!< Ticks that a delay of zero takes from the call to the return. They are subtracted from the delays. */
+#endif
+}sChronoClock;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
 
@@ -173,7 +447,7 @@ typedef struct {
  * @attention This function MUST be called before using any other function in this library.
  * 
  * @param tickValue If module is configured with TICK_TYPE_VARIABLE, pointer to the memory location that contains the tick value,
- *                  otherwise pointer to the function that returns tick value.
+ *                  otherwise pointer to the function that returns tick value. There is no parameter with TICK_TYPE_HOST.
  * @retval initStatus: returns 0 if successful and 1 if it fails.
  */
 
@@ -182,15 +456,50 @@ typedef struct {
   chrono_res_t fChrono_Init(volatile tick_t *tickValue);
 
 #elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-  
-  typedef tick_t(*fpTick_t)(void);
+
   chrono_res_t fChrono_Init(tick_t(*fpTickValue)(void));
 
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+
+  chrono_res_t fChrono_Init(void);
+
 #else
 
   #error "CHRONO_TICK_TYPE must be defined"
 
 #endif
+
+/**
+ * @brief Initializes a clock with its own tick generator.
+ * 
+ * @param clock Pointer to the clock object
+ * @param config Pointer to the configuration of the clock
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChronoClock_Init(sChronoClock * const clock, sChronoClockConfig const * const config);
+
+/**
+ * @brief Measures the frequency of the tick generator against a reference clock and sets the tick period of the clock to it.
+ * 
+ * @param reference Pointer to the reference clock, e.g., a timer with a known frequency
+ * @param windowNs Length of the measurement window in nanoseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval calibrationStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+chrono_res_t fChrono_Calibrate(sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result);
+chrono_res_t fChronoClock_Calibrate(sChronoClock * const clock, sChronoClock const * const reference, uint64_t windowNs, sChronoCalibration * const result);
+
+/**
+ * @brief Initializes chrono module with a host cycle counter and calibrates its frequency against CLOCK_MONOTONIC.
+ * 
+ * @param windowUs Length of the measurement window in microseconds
+ * @param result Pointer to the result of the calibration. It can be NULL.
+ * @retval initStatus: returns CHRONO_OK if successful, otherwise the error code.
+ */
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST) && (CHRONO_TICK_HOST_SOURCE != TICK_HOST_MONOTONIC_RAW) && (CHRONO_TICK_HOST_SOURCE != TICK_HOST_MONOTONIC_COARSE)
+chrono_res_t fChrono_InitCalibrated(uint32_t windowUs, sChronoCalibration * const result);
+#endif
+
 /** @} */ //End of INIT_FUNCTION
 
 /** @defgroup FUNCTIONAL_API Functional API in chrono module
@@ -214,18 +523,47 @@ bool_t fChrono_IsTickSAvailable(void);
  * @retval ram usage in byte.
  */
 uint32_t fChrono_GetRamUsage(void);
+uint32_t fChrono_GetChronoRamUsage(void);
+uint32_t fChrono_GetDeadlineRamUsage(void);
+uint32_t fChrono_GetCompactRamUsage(void);
+
+/**
+ * @brief Returns the default clock, which is used by fChrono_xxx() functions.
+ * 
+ * @retval clock: Pointer to the default clock
+ */
+sChronoClock const * fChrono_GetDefaultClock(void);
 
 /**
  * @brief Get current tick.
  * 
  * @retval tick: Current tick (raw)
  */
+#ifndef CHRONO_INLINE
 tick_t fChrono_GetTick(void);
+#endif
+tick_t fChronoClock_GetTick(sChronoClock const * const clock);
+
+/**
+ * @brief Returns the number of ticks since the initialization of the clock, extended to 64 bits.
+ * @note These functions are lock-free and re-entrant. They can be called from interrupts, threads and the main loop without a critical section.
+ * @attention The tick must be read at least once per counter period (e.g., by calling one of these functions), otherwise overflows are lost.
+ * @retval tick64: Ticks since calling fChrono_Init() or fChronoClock_Init()
+ */
+uint64_t fChrono_GetTick64(void);
+uint64_t fChronoClock_GetTick64(sChronoClock const * const clock);
+
+/**
+ * @brief Observes the tick of the clock, so the overflow of the tick generator is counted in the 64-bit tick.
+ * @note Call these functions from the overflow interrupt of the tick generator, or periodically at least once per period of the tick generator,
+ *       if the application may not read the time in such an interval. They are lock-free and re-entrant.
+ */
+void fChrono_UpdateTimebase(void);
+void fChronoClock_UpdateTimebase(sChronoClock const * const clock);
 
 /**
  * @brief Returns the amount of time converted to microseconds, milliseconds & seconds since calling fChrono_Init().
- * @note This functions are not re-entrant. if this condition may be happen, user should use critical section
- *       for prevent it.
+ * @note These functions are lock-free and re-entrant. They can be called from interrupts, threads and the main loop without a critical section.
  * @retval timeLength: Time length since calling fChrono_Init() in microseconds, milliseconds & seconds
  */
 uint64_t fChrono_GetContinuousTickUs(void);
@@ -253,9 +591,19 @@ tick_t fChrono_GetTickInitValue(void);
  */
 uint32_t fChrono_GetTickToNsCoef(void);
 
+/**
+ * @brief Returns the tick period in nanoseconds as the ratio of numerator to denominator.
+ * 
+ * @retval tickPeriod: Numerator and denominator of the tick period
+ */
+uint32_t fChrono_GetTickPeriodNum(void);
+uint32_t fChrono_GetTickPeriodDen(void);
+
 /**
  * @brief Returns the pointer to the tick generator.
  * 
+ * @note With TICK_TYPE_HOST, it returns fChrono_GetHostTick(), which reads the host counter of chrono_config.h. It can be used as the GetTickValue of a user clock.
+ * 
  * @retval tickPointer: Pointer to the tick generator.
  */
 #if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
@@ -266,6 +614,11 @@ uint32_t fChrono_GetTickToNsCoef(void);
 
   fpTick_t fChrono_GetTickPointer(void);
 
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+
+  fpTick_t fChrono_GetTickPointer(void);
+  tick_t fChrono_GetHostTick(void);
+
 #else
 
   #error "CHRONO_TICK_TYPE must be defined"
@@ -288,6 +641,10 @@ timeS_t fChrono_GetMaxMeasurableTimeS(void);
 timeMs_t fChrono_GetMaxMeasurableTimeMs(void);
 timeUs_t fChrono_GetMaxMeasurableTimeUs(void);
 
+timeS_t fChronoClock_GetMaxMeasurableTimeS(sChronoClock const * const clock);
+timeMs_t fChronoClock_GetMaxMeasurableTimeMs(sChronoClock const * const clock);
+timeUs_t fChronoClock_GetMaxMeasurableTimeUs(sChronoClock const * const clock);
+
 /** @} */ //End of MAX_MEASURABLE_TIME
 
 /** @defgroup TIME_SPAN
@@ -300,9 +657,27 @@ timeS_t fChrono_TimeSpanS(tick_t startTick, tick_t endTick);
 timeMs_t fChrono_TimeSpanMs(tick_t startTick, tick_t endTick);
 timeUs_t fChrono_TimeSpanUs(tick_t startTick, tick_t endTick);
 tick_t fChrono_TimeSpanTick(tick_t startTick, tick_t endTick);
+uint64_t fChrono_TimeSpanNs(tick_t startTick, tick_t endTick);
+
+timeS_t fChronoClock_TimeSpanS(sChronoClock const * const clock, tick_t startTick, tick_t endTick);
+timeMs_t fChronoClock_TimeSpanMs(sChronoClock const * const clock, tick_t startTick, tick_t endTick);
+timeUs_t fChronoClock_TimeSpanUs(sChronoClock const * const clock, tick_t startTick, tick_t endTick);
+tick_t fChronoClock_TimeSpanTick(sChronoClock const * const clock, tick_t startTick, tick_t endTick);
+uint64_t fChronoClock_TimeSpanNs(sChronoClock const * const clock, tick_t startTick, tick_t endTick);
 
 /** @} */ //End of TIME_SPAN
 
+/** @defgroup TIME_TO_TICK
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions convert a time length to a 64-bit number of ticks.
+ *  @{
+ */
+
+uint64_t fChrono_UsToTicks(timeUs_t time);
+uint64_t fChronoClock_UsToTicks(sChronoClock const * const clock, timeUs_t time);
+
+/** @} */ //End of TIME_TO_TICK
+
 /** @defgroup DELAY
  *  @ingroup FUNCTIONAL_API
  *  @brief These functions generate delay.
@@ -313,6 +688,38 @@ void fChrono_DelayS(timeS_t delayS);
 void fChrono_DelayMs(timeMs_t delayMs);
 void fChrono_DelayUs(timeUs_t delayUs);
 
+void fChronoClock_DelayS(sChronoClock const * const clock, timeS_t delayS);
+void fChronoClock_DelayMs(sChronoClock const * const clock, timeMs_t delayMs);
+void fChronoClock_DelayUs(sChronoClock const * const clock, timeUs_t delayUs);
+
+void fChrono_DelayTicks(uint64_t delayTick);
+void fChronoClock_DelayTicks(sChronoClock const * const clock, uint64_t delayTick);
+
+/**
+ * @brief Sets the function that the delay functions call to sleep, and returns the spin window of the delays.
+ * 
+ * @note These functions are only available when CHRONO_DELAY_SLEEP is defined in chrono_config.h.
+ */
+#ifdef CHRONO_DELAY_SLEEP
+void fChrono_SetDelaySleep(fpSleep_t sleep);
+uint32_t fChrono_GetDelaySpinWindowNs(void);
+#endif
+
+/**
+ * @brief Returns the fixed cost of the delay functions and of a start/elapsed measurement, which is measured at init and subtracted automatically.
+ * 
+ * @note These functions are only available when CHRONO_OVERHEAD_COMPENSATION is defined in chrono_config.h.
+ * 
+ * @retval overhead: Overhead (ticks)
+ */
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+uint64_t fChrono_GetDelayOverheadTick(void);
+uint64_t fChrono_GetElapsedOverheadTick(void);
+
+uint64_t fChronoClock_GetDelayOverheadTick(sChronoClock const * const clock);
+uint64_t fChronoClock_GetElapsedOverheadTick(sChronoClock const * const clock);
+#endif
+
 /** @} */ //End of DELAY
 
 /** @defgroup OBJECTIVE_API Objective API in the chrono module
@@ -327,9 +734,14 @@ void fChrono_DelayUs(timeUs_t delayUs);
  *  @{
  */
 
+#ifndef CHRONO_INLINE
 void fChrono_Start(sChrono * const me);
+#endif
 void fChrono_Stop(sChrono * const me);
 
+void fChronoClock_Start(sChronoClock const * const clock, sChrono * const me);
+void fChronoClock_Stop(sChronoClock const * const clock, sChrono * const me);
+
 /** @} */ //End of DELAY
 
 /** @defgroup ELAPSED
@@ -338,9 +750,19 @@ void fChrono_Stop(sChrono * const me);
  *  @{
  */
 
+#ifndef CHRONO_INLINE
 timeS_t fChrono_ElapsedS(sChrono const * const me);
 timeMs_t fChrono_ElapsedMs(sChrono const * const me);
 timeUs_t fChrono_ElapsedUs(sChrono const * const me);
+uint64_t fChrono_ElapsedNs(sChrono const * const me);
+uint64_t fChrono_ElapsedTick(sChrono const * const me);
+#endif
+
+timeS_t fChronoClock_ElapsedS(sChronoClock const * const clock, sChrono const * const me);
+timeMs_t fChronoClock_ElapsedMs(sChronoClock const * const clock, sChrono const * const me);
+timeUs_t fChronoClock_ElapsedUs(sChronoClock const * const clock, sChrono const * const me);
+uint64_t fChronoClock_ElapsedNs(sChronoClock const * const clock, sChrono const * const me);
+uint64_t fChronoClock_ElapsedTick(sChronoClock const * const clock, sChrono const * const me);
 
 /** @} */ //End of ELAPSED
 
@@ -352,6 +774,14 @@ timeUs_t fChrono_ElapsedUs(sChrono const * const me);
 timeS_t fChrono_LeftS(sChrono * const me);
 timeMs_t fChrono_LeftMs(sChrono * const me);
 timeUs_t fChrono_LeftUs(sChrono * const me);
+uint64_t fChrono_LeftNs(sChrono * const me);
+uint64_t fChrono_LeftTick(sChrono * const me);
+
+timeS_t fChronoClock_LeftS(sChronoClock const * const clock, sChrono * const me);
+timeMs_t fChronoClock_LeftMs(sChronoClock const * const clock, sChrono * const me);
+timeUs_t fChronoClock_LeftUs(sChronoClock const * const clock, sChrono * const me);
+uint64_t fChronoClock_LeftNs(sChronoClock const * const clock, sChrono * const me);
+uint64_t fChronoClock_LeftTick(sChronoClock const * const clock, sChrono * const me);
 
 /** @} */ //End of LEFT
 
@@ -364,22 +794,126 @@ timeUs_t fChrono_LeftUs(sChrono * const me);
 void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout);
 void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout);
 void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout);
+void fChrono_StartTimeoutNs(sChrono * const me, uint64_t timeout);
+void fChrono_StartTimeoutTicks(sChrono * const me, uint64_t timeout);
+#ifndef CHRONO_INLINE
 bool_t fChrono_IsTimeout(sChrono * const me);
+#endif
+
+void fChronoClock_StartTimeoutS(sChronoClock const * const clock, sChrono * const me, timeS_t timeout);
+void fChronoClock_StartTimeoutMs(sChronoClock const * const clock, sChrono * const me, timeMs_t timeout);
+void fChronoClock_StartTimeoutUs(sChronoClock const * const clock, sChrono * const me, timeUs_t timeout);
+void fChronoClock_StartTimeoutNs(sChronoClock const * const clock, sChrono * const me, uint64_t timeout);
+void fChronoClock_StartTimeoutTicks(sChronoClock const * const clock, sChrono * const me, uint64_t timeout);
+bool_t fChronoClock_IsTimeout(sChronoClock const * const clock, sChrono * const me);
 
 /** @} */ //End of TIMEOUT
 
+/** @defgroup PERIOD
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions run a chrono object that is started in timeout mode as a phase-locked periodic timer.
+ *  @{
+ */
+
+bool_t fChrono_IsPeriodDue(sChrono * const me, uint8_t policy, uint32_t * const missed);
+bool_t fChronoClock_IsPeriodDue(sChronoClock const * const clock, sChrono * const me, uint8_t policy, uint32_t * const missed);
+
+/** @} */ //End of PERIOD
+
 /** @defgroup INTERVAL
  *  @ingroup FUNCTIONAL_API
  *  @brief These functions return the time interval between two consecutive calls.
  *  @{
  */
 
+#ifndef CHRONO_INLINE
 timeS_t fChrono_IntervalS(sChrono * const me);
 timeMs_t fChrono_IntervalMs(sChrono * const me);
 timeUs_t fChrono_IntervalUs(sChrono * const me);
+uint64_t fChrono_IntervalNs(sChrono * const me);
+uint64_t fChrono_IntervalTick(sChrono * const me);
+#endif
+
+timeS_t fChronoClock_IntervalS(sChronoClock const * const clock, sChrono * const me);
+timeMs_t fChronoClock_IntervalMs(sChronoClock const * const clock, sChrono * const me);
+timeUs_t fChronoClock_IntervalUs(sChronoClock const * const clock, sChrono * const me);
+uint64_t fChronoClock_IntervalNs(sChronoClock const * const clock, sChrono * const me);
+uint64_t fChronoClock_IntervalTick(sChronoClock const * const clock, sChrono * const me);
 
 /** @} */ //End of INTERVAL
 
+/** @defgroup DEADLINE
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions work on sChronoDeadline objects. They are the same as the timeout functions, but a poll is a compare with the expiry tick.
+ *  @{
+ */
+
+void fChrono_DeadlineStartS(sChronoDeadline * const me, timeS_t timeout);
+void fChrono_DeadlineStartMs(sChronoDeadline * const me, timeMs_t timeout);
+void fChrono_DeadlineStartUs(sChronoDeadline * const me, timeUs_t timeout);
+void fChrono_DeadlineStartNs(sChronoDeadline * const me, uint64_t timeout);
+void fChrono_DeadlineStartTicks(sChronoDeadline * const me, uint64_t timeout);
+void fChrono_DeadlineStop(sChronoDeadline * const me);
+#ifndef CHRONO_INLINE
+bool_t fChrono_DeadlineIsTimeout(sChronoDeadline * const me);
+#endif
+timeS_t fChrono_DeadlineLeftS(sChronoDeadline * const me);
+timeMs_t fChrono_DeadlineLeftMs(sChronoDeadline * const me);
+timeUs_t fChrono_DeadlineLeftUs(sChronoDeadline * const me);
+uint64_t fChrono_DeadlineLeftNs(sChronoDeadline * const me);
+uint64_t fChrono_DeadlineLeftTick(sChronoDeadline * const me);
+
+void fChronoClock_DeadlineStartS(sChronoClock const * const clock, sChronoDeadline * const me, timeS_t timeout);
+void fChronoClock_DeadlineStartMs(sChronoClock const * const clock, sChronoDeadline * const me, timeMs_t timeout);
+void fChronoClock_DeadlineStartUs(sChronoClock const * const clock, sChronoDeadline * const me, timeUs_t timeout);
+void fChronoClock_DeadlineStartNs(sChronoClock const * const clock, sChronoDeadline * const me, uint64_t timeout);
+void fChronoClock_DeadlineStartTicks(sChronoClock const * const clock, sChronoDeadline * const me, uint64_t timeout);
+void fChronoClock_DeadlineStop(sChronoClock const * const clock, sChronoDeadline * const me);
+bool_t fChronoClock_DeadlineIsTimeout(sChronoClock const * const clock, sChronoDeadline * const me);
+timeS_t fChronoClock_DeadlineLeftS(sChronoClock const * const clock, sChronoDeadline * const me);
+timeMs_t fChronoClock_DeadlineLeftMs(sChronoClock const * const clock, sChronoDeadline * const me);
+timeUs_t fChronoClock_DeadlineLeftUs(sChronoClock const * const clock, sChronoDeadline * const me);
+uint64_t fChronoClock_DeadlineLeftNs(sChronoClock const * const clock, sChronoDeadline * const me);
+uint64_t fChronoClock_DeadlineLeftTick(sChronoClock const * const clock, sChronoDeadline * const me);
+
+/** @} */ //End of DEADLINE
+
+/** @defgroup COMPACT
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions work on sChronoCompact objects. They are the same as the timeout functions of the chrono object.
+ *  @{
+ */
+
+bool_t fChrono_CompactStartS(sChronoCompact * const me, timeS_t timeout);
+bool_t fChrono_CompactStartMs(sChronoCompact * const me, timeMs_t timeout);
+bool_t fChrono_CompactStartUs(sChronoCompact * const me, timeUs_t timeout);
+bool_t fChrono_CompactStartNs(sChronoCompact * const me, uint64_t timeout);
+bool_t fChrono_CompactStartTicks(sChronoCompact * const me, uint64_t timeout);
+void fChrono_CompactStop(sChronoCompact * const me);
+#ifndef CHRONO_INLINE
+bool_t fChrono_CompactIsTimeout(sChronoCompact * const me);
+#endif
+timeS_t fChrono_CompactLeftS(sChronoCompact * const me);
+timeMs_t fChrono_CompactLeftMs(sChronoCompact * const me);
+timeUs_t fChrono_CompactLeftUs(sChronoCompact * const me);
+uint64_t fChrono_CompactLeftNs(sChronoCompact * const me);
+uint64_t fChrono_CompactLeftTick(sChronoCompact * const me);
+
+bool_t fChronoClock_CompactStartS(sChronoClock const * const clock, sChronoCompact * const me, timeS_t timeout);
+bool_t fChronoClock_CompactStartMs(sChronoClock const * const clock, sChronoCompact * const me, timeMs_t timeout);
+bool_t fChronoClock_CompactStartUs(sChronoClock const * const clock, sChronoCompact * const me, timeUs_t timeout);
+bool_t fChronoClock_CompactStartNs(sChronoClock const * const clock, sChronoCompact * const me, uint64_t timeout);
+bool_t fChronoClock_CompactStartTicks(sChronoClock const * const clock, sChronoCompact * const me, uint64_t timeout);
+void fChronoClock_CompactStop(sChronoClock const * const clock, sChronoCompact * const me);
+bool_t fChronoClock_CompactIsTimeout(sChronoClock const * const clock, sChronoCompact * const me);
+timeS_t fChronoClock_CompactLeftS(sChronoClock const * const clock, sChronoCompact * const me);
+timeMs_t fChronoClock_CompactLeftMs(sChronoClock const * const clock, sChronoCompact * const me);
+timeUs_t fChronoClock_CompactLeftUs(sChronoClock const * const clock, sChronoCompact * const me);
+uint64_t fChronoClock_CompactLeftNs(sChronoClock const * const clock, sChronoCompact * const me);
+uint64_t fChronoClock_CompactLeftTick(sChronoClock const * const clock, sChronoCompact * const me);
+
+/** @} */ //End of COMPACT
+
 /** @} */ //End of OBJECTIVE_API
 
 /* Exported variables --------------------------------------------------------*/
@@ -388,6 +922,14 @@ timeUs_t fChrono_IntervalUs(sChrono * const me);
 }
 #endif
 
+/**
+ * @brief In CHRONO_INLINE mode the hot functions of the objective API are defined as static inline functions in chrono_inline.h.
+ * 
+ */
+#ifdef CHRONO_INLINE
+  #include "chrono_inline.h"
+#endif
+
 #endif /* CHRONO_H */
 
 /************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -31,7 +31,7 @@
   - Simply use the provided macros in your application to scale the rate of execution.
   
   ## Using macros
-  There are two types of macros available for users:
+  There are three types of macros available for users:
   1- Run Part of Code Just Once:
     - Declare a RUN_ONCE variable using RUN_ONCE_DEF_().
     - Reset the state of this variable using RUN_ONCE_RESET_().
@@ -88,6 +88,15 @@
         - RUN_EVERY_S_OBJ_FORCE_(): For seconds intervals in force mode
       - Use RUN_END_ to mark the end of the code block.
       - Place your application code inside this block to manage its execution relative to the main runtime.
+    2-3- Declare a phase-locked RUN_EVERY:
+      - RUN_EVERY_XX_() restarts its interval when the code block runs, so the lateness of the main loop adds up to the interval.
+      - RUN_EVERY_LOCKED_US_(), RUN_EVERY_LOCKED_MS_(), RUN_EVERY_LOCKED_S_() and their _OBJ_ and _FORCE_ variants keep the phase of the intervals.
+      - Pass CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE to select how the missed intervals are handled.
+      - Inside the code block, name_missed holds the number of missed intervals.
+    2-4- Declare an instrumented RUN_EVERY:
+      - RUN_EVERY_STATS_US_(), RUN_EVERY_STATS_MS_(), RUN_EVERY_STATS_S_() and their _OBJ_ and _FORCE_ variants take a pointer to an sChronoRunStats object.
+      - Each activation records its period, its start jitter in a histogram and whether it has missed a whole interval.
+      - Read the object at run time to find the blocks that are delayed by the rest of the loop. fChrono_RunStatsMeanPeriod() returns the mean period.
   
   Below is a code example of how to use this module with static macros.
   
@@ -129,6 +138,41 @@
   }
   @endcode
 
+  3- Run Stackless Tasks:
+    - fChrono_DelayUs() and the other delay functions busy-wait and block the whole main loop.
+    - Write a sequential state machine as a function that returns uint8_t, and put its body between CHRONO_TASK_BEGIN_() and CHRONO_TASK_END_().
+    - Inside the body, CHRONO_AWAIT_US_(), CHRONO_AWAIT_MS_() and CHRONO_AWAIT_S_() wait for a time, and CHRONO_AWAIT_UNTIL_US_() and the
+      other CHRONO_AWAIT_UNTIL macros wait for a condition with a timeout. They return from the function and continue from the same point in the next call.
+    - Each task keeps its resume point and its chrono object in an sChronoTask, so many tasks can run side by side in one main loop.
+
+  @code
+  static uint8_t Blink(sChronoTask * const task) {
+
+    CHRONO_TASK_BEGIN_(task);
+
+    while(TRUE) {
+      //Turn the LED on
+      CHRONO_AWAIT_MS_(task, 100);
+      //Turn the LED off
+      CHRONO_AWAIT_UNTIL_MS_(task, isButtonPressed, 900);
+    }
+
+    CHRONO_TASK_END_(task);
+  }
+
+  int main(void)
+  {
+    static sChronoTask blinkTask;
+
+    while(TRUE)
+    {
+      (void)Blink(&blinkTask);
+      //Run the other tasks
+      //...
+    }
+  }
+  @endcode
+
   Refer to the comments above each macro for more information on usage.
   @mainpage
   */
@@ -145,6 +189,21 @@ extern "C" {
 #include "chrono.h"
 
 /* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Number of bins in the start jitter histogram of sChronoRunStats.
+ * 
+ */
+#ifndef CHRONO_RUN_STATS_BINS
+#define CHRONO_RUN_STATS_BINS   (8U)
+#endif
+
+/**
+ * @brief Return values of a task function that uses the CHRONO_TASK macros.
+ * 
+ */
+#define CHRONO_TASK_WAITING     (0U)
+#define CHRONO_TASK_ENDED       (1U)
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup RUN_ONCE Run once macros
  *  @{
@@ -524,6 +583,420 @@ extern "C" {
 
 /** @} */ //End of RUN_EVERY_QTY
 
+/** @defgroup RUN_EVERY_LOCKED Phase-locked macros
+  * @ingroup RUN_EVERY
+  * @{
+  */
+
+/**
+ * @brief Base macro for marking the start of a code block that runs at regular intervals without drift.
+ * 
+ * @note Unlike RUN_EVERY_BASE_(), the next interval starts at the end of the current one instead of the tick that the code block runs,
+ *       so the lateness of the main loop doesn't accumulate. See fChrono_IsPeriodDue().
+ * @note Inside the code block, name_##_missed holds the number of intervals that were missed in addition to the current one.
+ * @note It is essential to use the RUN_END_ macro to conclude the code block.
+ * @note DO NOT USE this macro directly in your application. Instead, utilize appropriate wrappers such as RUN_EVERY_LOCKED_US_OBJ_(), RUN_EVERY_LOCKED_US_(), etc.
+ * 
+ * @param name_ Name of the code block.
+ * @param interval_ The time interval for executing the code block.
+ * @param chrono_ A pointer to the chrono object.
+ * @param ts_ The time sample of the RUN_EVERY object. Use Us for microseconds, Ms for milliseconds, and S for seconds.
+ * @param force_ If TRUE, the code block is also executed during the first encounter. The intervals are counted from the first encounter in both cases.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ */
+#define RUN_EVERY_LOCKED_BASE_(name_, interval_, chrono_, ts_, force_, policy_) \
+    uint32_t name_##_missed = 0U;\
+    bool_t name_##_first = FALSE;\
+    if((chrono_)->_run == FALSE) {\
+      fChrono_StartTimeout##ts_((chrono_), (interval_));\
+      name_##_first = (force_);\
+    }\
+    if(name_##_first || fChrono_IsPeriodDue((chrono_), (policy_), &name_##_missed)) {\
+        (void)(name_##_missed);
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with microsecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_US_OBJ_(name_, chrono_, intervalUs_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalUs_, chrono_, Us, FALSE, policy_)
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with microsecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_US_OBJ_FORCE_(name_, chrono_, intervalUs_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalUs_, chrono_, Us, TRUE, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with microsecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_US_(name_, intervalUs_, policy_) \
+    static sChrono __run_every_locked_us_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_US_OBJ_(name_, &__run_every_locked_us_##name_##__, intervalUs_, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with microsecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_US_FORCE_(name_, intervalUs_, policy_) \
+    static sChrono __run_every_locked_us_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_US_OBJ_FORCE_(name_, &__run_every_locked_us_##name_##__, intervalUs_, policy_)
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with millisecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_MS_OBJ_(name_, chrono_, intervalMs_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalMs_, chrono_, Ms, FALSE, policy_)
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with millisecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_MS_OBJ_FORCE_(name_, chrono_, intervalMs_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalMs_, chrono_, Ms, TRUE, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with millisecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_MS_(name_, intervalMs_, policy_) \
+    static sChrono __run_every_locked_ms_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_MS_OBJ_(name_, &__run_every_locked_ms_##name_##__, intervalMs_, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with millisecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_MS_FORCE_(name_, intervalMs_, policy_) \
+    static sChrono __run_every_locked_ms_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_MS_OBJ_FORCE_(name_, &__run_every_locked_ms_##name_##__, intervalMs_, policy_)
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with second time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_S_OBJ_(name_, chrono_, intervalS_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalS_, chrono_, S, FALSE, policy_)
+
+/**
+ * @brief Objective phase-locked RUN_EVERY macro with second time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_S_OBJ_FORCE_(name_, chrono_, intervalS_, policy_) RUN_EVERY_LOCKED_BASE_(name_, intervalS_, chrono_, S, TRUE, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with second time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_S_(name_, intervalS_, policy_) \
+    static sChrono __run_every_locked_s_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_S_OBJ_(name_, &__run_every_locked_s_##name_##__, intervalS_, policy_)
+
+/**
+ * @brief Static phase-locked RUN_EVERY macro with second time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param policy_ Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE.
+ * 
+ */
+#define RUN_EVERY_LOCKED_S_FORCE_(name_, intervalS_, policy_) \
+    static sChrono __run_every_locked_s_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_LOCKED_S_OBJ_FORCE_(name_, &__run_every_locked_s_##name_##__, intervalS_, policy_)
+
+/** @} */ //End of RUN_EVERY_LOCKED
+
+/** @defgroup RUN_EVERY_STATS Instrumented macros
+  * @ingroup RUN_EVERY
+  * @{
+  */
+
+/**
+ * @brief Base macro for marking the start of a code block that runs at regular intervals and records the statistics of its activations.
+ * 
+ * @note It is the same as RUN_EVERY_BASE_(), and it passes the measured period of each activation to fChrono_RunStatsUpdate().
+ *       An activation costs a few additions and comparisons more than RUN_EVERY_BASE_().
+ *       The forced first activation has no previous activation, so it is not recorded.
+ * @note It is essential to use the RUN_END_ macro to conclude the code block.
+ * @note DO NOT USE this macro directly in your application. Instead, utilize appropriate wrappers such as RUN_EVERY_STATS_US_OBJ_(), RUN_EVERY_STATS_US_(), etc.
+ * 
+ * @param name_ Name of the code block.
+ * @param interval_ The time interval for executing the code block.
+ * @param chrono_ A pointer to the chrono object.
+ * @param ts_ The time sample of the RUN_EVERY object. Use Us for microseconds, Ms for milliseconds, and S for seconds.
+ * @param force_ If TRUE, RUN_EVERY will execute the code block immediately; if FALSE, it will only initialize its chrono object and run the code block in the next interval.
+ * @param stats_ A pointer to the sChronoRunStats object of the code block.
+ */
+#define RUN_EVERY_STATS_BASE_(name_, interval_, chrono_, ts_, force_, stats_) \
+    bool_t name_##_isForced = (((chrono_)->_run == FALSE) && (force_));\
+    RUN_EVERY_BASE_(name_, interval_, chrono_, ts_, force_)\
+        if(name_##_isForced == FALSE) {\
+          fChrono_RunStatsUpdate((stats_), (uint32_t)(name_##_elapsed##ts_), (uint32_t)(interval_));\
+        }
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with microsecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in microseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_US_OBJ_(name_, chrono_, intervalUs_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalUs_, chrono_, Us, FALSE, stats_)
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with microsecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ *       The forced activation has no measured period, so it is not recorded.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in microseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_US_OBJ_FORCE_(name_, chrono_, intervalUs_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalUs_, chrono_, Us, TRUE, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with microsecond time interval. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in microseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_US_(name_, intervalUs_, stats_) \
+    static sChrono __run_every_stats_us_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_US_OBJ_(name_, &__run_every_stats_us_##name_##__, intervalUs_, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with microsecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in microseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_US_FORCE_(name_, intervalUs_, stats_) \
+    static sChrono __run_every_stats_us_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_US_OBJ_FORCE_(name_, &__run_every_stats_us_##name_##__, intervalUs_, stats_)
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with millisecond time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in milliseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_MS_OBJ_(name_, chrono_, intervalMs_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalMs_, chrono_, Ms, FALSE, stats_)
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with millisecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ *       The forced activation has no measured period, so it is not recorded.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in milliseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_MS_OBJ_FORCE_(name_, chrono_, intervalMs_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalMs_, chrono_, Ms, TRUE, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with millisecond time interval. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in milliseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_MS_(name_, intervalMs_, stats_) \
+    static sChrono __run_every_stats_ms_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_MS_OBJ_(name_, &__run_every_stats_ms_##name_##__, intervalMs_, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with millisecond time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in milliseconds.
+ * 
+ */
+#define RUN_EVERY_STATS_MS_FORCE_(name_, intervalMs_, stats_) \
+    static sChrono __run_every_stats_ms_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_MS_OBJ_FORCE_(name_, &__run_every_stats_ms_##name_##__, intervalMs_, stats_)
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with second time interval. Marks the start of the code block.
+ * 
+ * @note This macro does not execute user code during the first encounter of the code block. It only initializes the chrono object and puts it in the run state.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in seconds.
+ * 
+ */
+#define RUN_EVERY_STATS_S_OBJ_(name_, chrono_, intervalS_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalS_, chrono_, S, FALSE, stats_)
+
+/**
+ * @brief Objective instrumented RUN_EVERY macro with second time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note This macro initializes the chrono object and puts it in the run state. It also forces RUN_EVERY to run the user code during the first encounter.
+ *       The forced activation has no measured period, so it is not recorded.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param chrono_ Pointer to the chrono object.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in seconds.
+ * 
+ */
+#define RUN_EVERY_STATS_S_OBJ_FORCE_(name_, chrono_, intervalS_, stats_) RUN_EVERY_STATS_BASE_(name_, intervalS_, chrono_, S, TRUE, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with second time interval. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in seconds.
+ * 
+ */
+#define RUN_EVERY_STATS_S_(name_, intervalS_, stats_) \
+    static sChrono __run_every_stats_s_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_S_OBJ_(name_, &__run_every_stats_s_##name_##__, intervalS_, stats_)
+
+/**
+ * @brief Static instrumented RUN_EVERY macro with second time interval in FORCE mode. Marks the start of the code block.
+ * 
+ * @note The chrono object is created statically. The statistics object is given by the user, so it can be read from anywhere in the application.
+ * @note It is essential to mark the end of the code block using the RUN_END_ macro.
+ * 
+ * @param name_ Name of the code block.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ * @param stats_ Pointer to the sChronoRunStats object that records the activations in seconds.
+ * 
+ */
+#define RUN_EVERY_STATS_S_FORCE_(name_, intervalS_, stats_) \
+    static sChrono __run_every_stats_s_##name_##__ = {FALSE, 0, 0, 0, FALSE};\
+    RUN_EVERY_STATS_S_OBJ_FORCE_(name_, &__run_every_stats_s_##name_##__, intervalS_, stats_)
+
+/** @} */ //End of RUN_EVERY_STATS
+
 /** @} */ //End of RUN_EVERY
 
 /**
@@ -557,9 +1030,12 @@ extern "C" {
  *
  * @note Use this macro when you want to wait for condition, but should 
  *       have a timeout for prevent lock in while loop.
+ * 
+ * @note Between two checks, the loop waits with CHRONO_SPIN_WAIT_(), if CHRONO_SPIN_HINT() is defined in chrono_config.h.
  */
 #define WAIT_FOR_WITH_TIMEOUT_US_(name_, condition_, timeoutUs_, isTimeout_) \
   (isTimeout_) = FALSE; \
+  uint32_t __wait_for_us_backoff_##name_##__ = 1U; \
   static sChrono __wait_for_us_##name_##__ = {FALSE, 0, 0, 0, FALSE}; \
   fChrono_StartTimeoutUs(&(__wait_for_us_##name_##__), timeoutUs_); \
   while(!(condition_)) { \
@@ -567,6 +1043,7 @@ extern "C" {
       (isTimeout_) = TRUE; \
       break; \
     } \
+    CHRONO_SPIN_WAIT_(__wait_for_us_backoff_##name_##__); \
   }
 
 /**
@@ -574,9 +1051,12 @@ extern "C" {
  *
  * @note Use this macro when you want to wait for condition, but should 
  *       have a timeout for prevent lock in while loop.
+ * 
+ * @note Between two checks, the loop waits with CHRONO_SPIN_WAIT_(), if CHRONO_SPIN_HINT() is defined in chrono_config.h.
  */
 #define WAIT_FOR_WITH_TIMEOUT_MS_(name_, condition_, timeoutMs_, isTimeout_) \
   (isTimeout_) = FALSE; \
+  uint32_t __wait_for_ms_backoff_##name_##__ = 1U; \
   static sChrono __wait_for_ms_##name_##__ = {FALSE, 0, 0, 0, FALSE}; \
   fChrono_StartTimeoutMs(&(__wait_for_ms_##name_##__), timeoutMs_); \
   while(!(condition_)) { \
@@ -584,6 +1064,7 @@ extern "C" {
       (isTimeout_) = TRUE; \
       break; \
     } \
+    CHRONO_SPIN_WAIT_(__wait_for_ms_backoff_##name_##__); \
   }
 
 /**
@@ -591,9 +1072,12 @@ extern "C" {
  *
  * @note Use this macro when you want to wait for condition, but should 
  *       have a timeout for prevent lock in while loop.
+ * 
+ * @note Between two checks, the loop waits with CHRONO_SPIN_WAIT_(), if CHRONO_SPIN_HINT() is defined in chrono_config.h.
  */
 #define WAIT_FOR_WITH_TIMEOUT_S_(name_, condition_, timeoutS_, isTimeout_) \
   (isTimeout_) = FALSE; \
+  uint32_t __wait_for_s_backoff_##name_##__ = 1U; \
   static sChrono __wait_for_s_##name_##__ = {FALSE, 0, 0, 0, FALSE}; \
   fChrono_StartTimeoutS(&(__wait_for_s_##name_##__), timeoutS_); \
   while(!(condition_)) { \
@@ -601,6 +1085,7 @@ extern "C" {
       (isTimeout_) = TRUE; \
       break; \
     } \
+    CHRONO_SPIN_WAIT_(__wait_for_s_backoff_##name_##__); \
   }
 
 /**
@@ -637,9 +1122,245 @@ extern "C" {
 #define PULSE_ONCE_FOR_MS_(name_, condition_, duration_, outPulse_)  PULSE_ONCE_FOR_BASE_(name_, condition_, duration_, outPulse_, Ms)
 #define PULSE_ONCE_FOR_S_(name_, condition_, duration_, outPulse_)  PULSE_ONCE_FOR_BASE_(name_, condition_, duration_, outPulse_, S)
 
+/** @defgroup CHRONO_TASK Stackless task macros
+ *  @brief These macros turn a function into a stackless task that waits without blocking the main loop.
+ *  @{
+ */
+
+/**
+ * @brief Marks the resume point of the task. A later call of the task function jumps here.
+ * 
+ * @note DO NOT USE this macro directly in your application. Only one CHRONO_TASK macro can be used in one line, because the line number is the resume point.
+ * 
+ */
+#define CHRONO_TASK_RESUME_POINT_(task_) \
+  (task_)->_line = (uint32_t)__LINE__;\
+  if(FALSE) {\
+    case __LINE__: ;\
+  }
+
+/**
+ * @brief Resets the task, so the next call of the task function starts from CHRONO_TASK_BEGIN_().
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ */
+#define CHRONO_TASK_RESET_(task_) (task_)->_line = 0U
+
+/**
+ * @brief Marks the start of the body of the task. It must be the first statement of the task function.
+ * 
+ * @note The task function returns uint8_t. It returns CHRONO_TASK_WAITING while the task waits and CHRONO_TASK_ENDED when it reaches CHRONO_TASK_END_().
+ *       Call the task function repeatedly, e.g., in the main loop. Each call runs the task until its next wait.
+ * @note Local variables of the task function are not kept between the calls. Keep the state of the task in static variables or in the object that holds the sChronoTask.
+ *       Don't use a switch statement around the wait macros.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ */
+#define CHRONO_TASK_BEGIN_(task_) \
+  switch((task_)->_line) {\
+    case 0U:
+
+/**
+ * @brief Marks the end of the body of the task. The task is reset and the task function returns CHRONO_TASK_ENDED.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ */
+#define CHRONO_TASK_END_(task_) \
+    default:\
+      break;\
+  }\
+  (task_)->_line = 0U;\
+  return CHRONO_TASK_ENDED
+
+/**
+ * @brief Returns from the task function once and continues from the next statement in the next call.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ */
+#define CHRONO_TASK_YIELD_(task_) \
+  (task_)->_line = (uint32_t)__LINE__;\
+  return CHRONO_TASK_WAITING;\
+  case __LINE__:
+
+/**
+ * @brief Waits while the condition is TRUE.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ * @param condition_ The condition that is checked in each call of the task function.
+ */
+#define CHRONO_AWAIT_WHILE_(task_, condition_) \
+  CHRONO_TASK_RESUME_POINT_(task_)\
+  if(condition_) {\
+    return CHRONO_TASK_WAITING;\
+  }
+
+/**
+ * @brief Base macro for waiting for a time interval without blocking.
+ * 
+ * @note DO NOT USE this macro directly in your application. Instead, utilize CHRONO_AWAIT_US_(), CHRONO_AWAIT_MS_() or CHRONO_AWAIT_S_().
+ * 
+ */
+#define CHRONO_AWAIT_BASE_(task_, delay_, ts_) \
+  fChrono_StartTimeout##ts_(&(task_)->_chrono, (delay_));\
+  CHRONO_AWAIT_WHILE_(task_, !fChrono_IsTimeout(&(task_)->_chrono))
+
+/**
+ * @brief Base macro for waiting for a condition with a timeout without blocking.
+ * 
+ * @note DO NOT USE this macro directly in your application. Instead, utilize CHRONO_AWAIT_UNTIL_US_(), CHRONO_AWAIT_UNTIL_MS_() or CHRONO_AWAIT_UNTIL_S_().
+ * 
+ */
+#define CHRONO_AWAIT_UNTIL_BASE_(task_, condition_, timeout_, ts_) \
+  fChrono_StartTimeout##ts_(&(task_)->_chrono, (timeout_));\
+  CHRONO_TASK_RESUME_POINT_(task_)\
+  if(condition_) {\
+    (task_)->_isTimeout = FALSE;\
+  } else if(fChrono_IsTimeout(&(task_)->_chrono)) {\
+    (task_)->_isTimeout = TRUE;\
+  } else {\
+    return CHRONO_TASK_WAITING;\
+  }
+
+/**
+ * @brief Waits for the specified time without blocking the main loop.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ * @param delay_ Time to wait in microseconds (US), milliseconds (MS) or seconds (S).
+ */
+#define CHRONO_AWAIT_US_(task_, delay_) CHRONO_AWAIT_BASE_(task_, delay_, Us)
+#define CHRONO_AWAIT_MS_(task_, delay_) CHRONO_AWAIT_BASE_(task_, delay_, Ms)
+#define CHRONO_AWAIT_S_(task_, delay_)  CHRONO_AWAIT_BASE_(task_, delay_, S)
+
+/**
+ * @brief Waits until the condition is TRUE or the timeout expires, without blocking the main loop.
+ * 
+ * @note After the wait, CHRONO_TASK_IS_TIMEOUT_() returns TRUE if the timeout expired before the condition became TRUE.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ * @param condition_ The condition that is checked in each call of the task function.
+ * @param timeout_ Timeout in microseconds (US), milliseconds (MS) or seconds (S).
+ */
+#define CHRONO_AWAIT_UNTIL_US_(task_, condition_, timeout_) CHRONO_AWAIT_UNTIL_BASE_(task_, condition_, timeout_, Us)
+#define CHRONO_AWAIT_UNTIL_MS_(task_, condition_, timeout_) CHRONO_AWAIT_UNTIL_BASE_(task_, condition_, timeout_, Ms)
+#define CHRONO_AWAIT_UNTIL_S_(task_, condition_, timeout_)  CHRONO_AWAIT_UNTIL_BASE_(task_, condition_, timeout_, S)
+
+/**
+ * @brief Returns TRUE if the last CHRONO_AWAIT_UNTIL of the task ended with a timeout.
+ * 
+ * @param task_ Pointer to the sChronoTask object.
+ */
+#define CHRONO_TASK_IS_TIMEOUT_(task_) ((task_)->_isTimeout)
+
+/** @} */ //End of CHRONO_TASK
+
 /* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Statistics of the activations of an instrumented RUN_EVERY block. Times are in the time scale of the block.
+  * 
+  * @note The period of an activation is the time since the previous activation, and its jitter is the period minus the interval,
+  *       or zero if the period is shorter than the interval.
+  *       Bin 0 of the jitter histogram counts the activations with no jitter, bin n counts the jitters in [2^(n-1), 2^n)
+  *       and the last bin also counts all larger jitters.
+  * @note A deadline miss is an activation that is one interval or more late, i.e., the block has missed a whole interval.
+  * @note The object must be zero-initialized (e.g., static) or reset with fChrono_RunStatsReset() before it is used.
+  * 
+  */
+typedef struct {
+
+  uint32_t Count;                             /*!< Number of recorded activations. */
+
+  uint32_t Misses;                            /*!< Number of deadline misses. */
+
+  uint32_t PeriodMin;                         /*!< Shortest period. */
+
+  uint32_t PeriodMax;                         /*!< Longest period. */
+
+  uint64_t PeriodTotal;                       /*!< Sum of the periods. The mean period is PeriodTotal / Count, see fChrono_RunStatsMeanPeriod(). */
+
+  uint32_t Jitter[CHRONO_RUN_STATS_BINS];     /*!< Histogram of the start jitter. */
+}sChronoRunStats;
+
+/**
+  * @brief State of a stackless task that uses the CHRONO_TASK macros.
+  * 
+  * @note The object must be zero-initialized (e.g., static) or reset with CHRONO_TASK_RESET_() before the task runs.
+  * 
+  */
+typedef struct {
+
+  uint32_t _line;       /*!< Resume point of the task, or zero for the start of the task. This parameter is private. */
+
+  bool_t _isTimeout;    /*!< TRUE if the last CHRONO_AWAIT_UNTIL ended with a timeout. This parameter is private. */
+
+  sChrono _chrono;      /*!< Chrono object of the waits of the task. This parameter is private. */
+}sChronoTask;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief Records one activation of an instrumented RUN_EVERY block.
+ * 
+ * @note A block only runs after its interval has elapsed in ticks, but the period and the interval are rounded to the time scale of the block.
+ *       An on-time activation can measure one unit less than the interval (e.g. 99 us for 100 us with a 7 ns tick), so periods shorter
+ *       than the interval are recorded with zero jitter.
+ * 
+ * @param stats Pointer to the statistics object
+ * @param period Time since the previous activation
+ * @param interval Interval of the block
+ */
+static inline void fChrono_RunStatsUpdate(sChronoRunStats * const stats, uint32_t period, uint32_t interval) {
+
+  uint32_t jitter = (period > interval) ? (period - interval) : 0U;
+  uint32_t bin = 0U;
+
+  if(jitter >= interval) {
+    stats->Misses++;
+  }
+
+  while((jitter != 0U) && (bin < (CHRONO_RUN_STATS_BINS - 1U))) {
+    jitter >>= 1U;
+    bin++;
+  }
+  stats->Jitter[bin]++;
+
+  if((stats->Count == 0U) || (period < stats->PeriodMin)) {
+    stats->PeriodMin = period;
+  }
+  if(period > stats->PeriodMax) {
+    stats->PeriodMax = period;
+  }
+  stats->PeriodTotal += period;
+  stats->Count++;
+}
+
+/**
+ * @brief Returns the mean period of the recorded activations.
+ * 
+ * @param stats Pointer to the statistics object
+ * @retval period: Mean period, or zero if no activation is recorded
+ */
+static inline uint32_t fChrono_RunStatsMeanPeriod(sChronoRunStats const * const stats) {
+
+  return (stats->Count == 0U) ? 0U : (uint32_t)(stats->PeriodTotal / stats->Count);
+}
+
+/**
+ * @brief Clears the statistics object.
+ * 
+ * @param stats Pointer to the statistics object
+ */
+static inline void fChrono_RunStatsReset(sChronoRunStats * const stats) {
+
+  stats->Count = 0U;
+  stats->Misses = 0U;
+  stats->PeriodMin = 0U;
+  stats->PeriodMax = 0U;
+  stats->PeriodTotal = 0U;
+  for(uint32_t i = 0U; i < CHRONO_RUN_STATS_BINS; i++) {
+    stats->Jitter[i] = 0U;
+  }
+}
+
 /* Exported variables --------------------------------------------------------*/
 
 #ifdef __cplusplus
@@ -0,0 +1,1153 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_inline.h
+  * @brief          : Chrono module inline kernel header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  
+  This file holds the tick-level kernels of the chrono module. chrono.c builds all
+  functions of the module on top of them.
+
+  If CHRONO_INLINE is defined in chrono_config.h, chrono.h includes this file and
+  the hot functions of the objective API (fChrono_GetTick(), fChrono_Start(),
+  fChrono_ElapsedS/Ms/Us/Ns/Tick(), fChrono_IsTimeout(), fChrono_DeadlineIsTimeout(), fChrono_CompactIsTimeout() and fChrono_IntervalS/Ms/Us/Ns/Tick())
+  become static inline functions of the default clock. In this mode a call compiles
+  down to a tick read, a subtraction and a compare, without a function call.
+  The user code doesn't change.
+
+  Users must not include this file directly or call the kernels in it.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_INLINE_H
+#define CHRONO_INLINE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono.h"
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+  #if (CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_RAW) || (CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_COARSE)
+    #include <time.h>
+    #if !defined(CLOCK_MONOTONIC_RAW) || !defined(CLOCK_MONOTONIC_COARSE)
+      #error "The clock_gettime() tick sources need a Linux C library. Compile with _GNU_SOURCE or _DEFAULT_SOURCE defined."
+    #endif
+  #elif (CHRONO_TICK_HOST_SOURCE == TICK_HOST_RDTSC) || (CHRONO_TICK_HOST_SOURCE == TICK_HOST_RDTSCP)
+    #if !defined(__GNUC__) || !(defined(__x86_64__) || defined(__i386__))
+      #error "TICK_HOST_RDTSC and TICK_HOST_RDTSCP need a GCC compatible compiler for x86."
+    #endif
+  #elif (CHRONO_TICK_HOST_SOURCE == TICK_HOST_CNTVCT)
+    #if !defined(__GNUC__) || !defined(__aarch64__)
+      #error "TICK_HOST_CNTVCT needs a GCC compatible compiler for arm64."
+    #endif
+  #else
+    #error "CHRONO_TICK_HOST_SOURCE must be defined in chrono_config.h file when CHRONO_TICK_TYPE is TICK_TYPE_HOST."
+  #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/**
+ * @brief Flag of the counting mode of a clock. It is set when the top value of the clock is 2^n-1.
+ * 
+ * @note fChronoClock_Init() adds it to the counting mode of the clock. The default clock passes it as a compile-time constant,
+ *       derived from CHRONO_TICK_TOP_VALUE, so the compiler keeps only the arithmetic of the configured counter range.
+ * 
+ */
+#define CHRONO_COUNTERMODE_MASKED_  (0x80U)
+
+/**
+ * @brief Returns TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN from a counting mode that may have the CHRONO_COUNTERMODE_MASKED_ flag.
+ * 
+ */
+#define CHRONO_COUNTERMODE_(mode_)  ((mode_) & (uint8_t)(~CHRONO_COUNTERMODE_MASKED_))
+
+/**
+ * @brief Returns TRUE if "top_" is 2^n-1, i.e., the counter range is a power of two and a tick difference can be masked.
+ * 
+ */
+#define CHRONO_IS_TOP_MASK_(top_)   ((((top_) & ((top_) + 1U))) == 0U)
+
+/**
+ * @brief Counting mode of the default clock, with CHRONO_COUNTERMODE_MASKED_ if CHRONO_TICK_TOP_VALUE is 2^n-1. It is a compile-time constant.
+ * 
+ */
+#define CHRONO_DEFAULT_COUNTERMODE_ \
+  ((uint8_t)(CHRONO_TICK_COUNTERMODE | (CHRONO_IS_TOP_MASK_((tick_t)CHRONO_TICK_TOP_VALUE) ? CHRONO_COUNTERMODE_MASKED_ : 0U)))
+
+/**
+ * @brief Returns the time length between "a" and "b" on the specified clock.
+ * 
+ * @note Chronologically, "a" must be a time tick after "b", but the value of "a" could be less than "b" i.e., when tick overflows.
+ * 
+ * @note "mode_" is the counting mode of the clock. For the default clock it is CHRONO_DEFAULT_COUNTERMODE_, so the compiler removes the branches of the other modes.
+ * 
+ * @note If the top value is 2^n-1 (CHRONO_COUNTERMODE_MASKED_), the difference is computed without a branch: the raw difference minus the
+ *       borrow of the overflow, masked with the top value. It gives the same result as the general form, i.e., top - (b - a) on overflow.
+ * 
+ */
+#define CHRONO_ELAPSED_(clock_, mode_, a, b) \
+  ((((mode_) & CHRONO_COUNTERMODE_MASKED_) != 0U) ? \
+    ((CHRONO_COUNTERMODE_(mode_) == TICK_COUNTERMODE_UP) ? \
+      ((((a) - (b)) - (uint8_t)((a) < (b))) & ((clock_)->_tickTopValue)) : \
+      ((((b) - (a)) - (uint8_t)((b) < (a))) & ((clock_)->_tickTopValue))) : \
+    ((CHRONO_COUNTERMODE_(mode_) == TICK_COUNTERMODE_UP) ? \
+      (((a) >= (b)) ? ((a) - (b)) : (((clock_)->_tickTopValue) - ((b) - (a)))) : \
+      (((a) <= (b)) ? ((b) - (a)) : (((clock_)->_tickTopValue) - ((a) - (b))))))
+
+/**
+ * @brief Reads the current tick of the specified clock.
+ * 
+ * @note "type_" is the tick type of the clock. For the default clock it is CHRONO_TICK_TYPE, so the compiler removes the branch of the other type.
+ * 
+ * @note With TICK_TYPE_HOST, the default clock reads the host counter with ChronoHostTick(), without a pointer or a function call.
+ * 
+ */
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+  #define CHRONO_GET_TICK_(clock_, type_) \
+    (((type_) == TICK_TYPE_HOST) ? ChronoHostTick() : \
+      (((type_) == TICK_TYPE_VARIABLE) ? (*((clock_)->_pTickValue)) : ((clock_)->_getTickValue())))
+#else
+  #define CHRONO_GET_TICK_(clock_, type_) \
+    (((type_) == TICK_TYPE_VARIABLE) ? (*((clock_)->_pTickValue)) : ((clock_)->_getTickValue()))
+#endif
+
+/**
+ * @brief Returns the ticks between two tags of a chrono object.
+ * 
+ * @note If CHRONO_TICK_EXTENSION is defined, the tags are 64-bit ticks that don't overflow. Otherwise they are raw ticks.
+ * 
+ */
+#ifdef CHRONO_TICK_EXTENSION
+  #define CHRONO_OBJ_ELAPSED_(clock_, mode_, a, b) ((a) - (b))
+#else
+  #define CHRONO_OBJ_ELAPSED_(clock_, mode_, a, b) CHRONO_ELAPSED_((clock_), (mode_), (a), (b))
+#endif
+
+/**
+ * @brief Orders the accesses to the timebase of a clock.
+ * 
+ * @note On a single core, volatile accesses are enough. The full barrier is used when the compiler provides it, so the timebase is also safe between cores.
+ * 
+ */
+#if defined(__GNUC__)
+  #define CHRONO_TIMEBASE_BARRIER_() __sync_synchronize()
+#else
+  #define CHRONO_TIMEBASE_BARRIER_()
+#endif
+
+/**
+ * @brief Marks the timebase as being written, if its sequence number is still "seq_".
+ * 
+ * @note Without a native compare-and-swap, the mark is a plain store. It is still safe on a single core, because a preempting writer
+ *       always finishes before the preempted one continues and the preempted one only writes the slot that readers don't use.
+ * 
+ */
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)
+  #define CHRONO_TIMEBASE_CLAIM_(timebase_, seq_) __sync_bool_compare_and_swap(&(timebase_)->_seq, (seq_), ((seq_) | 1U))
+#else
+  #define CHRONO_TIMEBASE_CLAIM_(timebase_, seq_) (((timebase_)->_seq = ((seq_) | 1U)), TRUE)
+#endif
+
+/**
+ * @brief Arguments of the clock kernel functions for the default clock and for a user clock.
+ * 
+ * @note The default clock passes its tick type and counting mode as compile-time constants. This way the wrappers of the default clock
+ *       compile to the same code as a module with a single clock.
+ * 
+ */
+#define CHRONO_DEFAULT_CLOCK_  (&_chrono), (CHRONO_TICK_TYPE), (CHRONO_DEFAULT_COUNTERMODE_)
+#define CHRONO_CLOCK_(clock_)  (clock_), ((clock_)->_tickType), ((clock_)->_counterMode)
+
+/**
+ * @brief Returns TRUE if "type_" is an integral type.
+ * 
+ * @note The expression is a compile-time constant, so the compiler removes the branch that is not taken.
+ * 
+ */
+#define CHRONO_IS_INTEGRAL_TYPE_(type_) (((type_)1 / (type_)2) == (type_)0)
+
+/**
+ * @brief Converts a tick count to time in the specified type, and time in the specified type to a tick count, using the precomputed scale of that time unit.
+ * 
+ * @note The kernel is selected at compile time from the time type: a multiply-and-shift for integral types (see ChronoScaleApply()),
+ *       which gives floor(ticks * Num / Den), and one multiplication by the precomputed ratio for float and double.
+ *       This way an integral time type never pulls in floating point code and a floating point time type never needs a division.
+ *       C11 compilers select the kernel with _Generic, C++ compilers with a template and older C compilers with a constant expression
+ *       that the compiler folds.
+ * 
+ */
+#if defined(__cplusplus)
+
+#define CHRONO_TICK_TO_TIME_(type_, ticks_, scale_) (ChronoScaleKernel<type_>::ToTime(&(scale_), (uint64_t)(ticks_)))
+#define CHRONO_TIME_TO_TICK64_(type_, time_, scale_) (ChronoScaleKernel<type_>::ToTick(&(scale_), (time_)))
+
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+
+#define CHRONO_TICK_TO_TIME_(type_, ticks_, scale_) \
+  ((type_)_Generic((type_)0, \
+    float: ChronoScaleToFloat, \
+    double: ChronoScaleToDouble, \
+    long double: ChronoScaleToDouble, \
+    default: ChronoScaleApply)(&(scale_), (uint64_t)(ticks_)))
+
+#define CHRONO_TIME_TO_TICK64_(type_, time_, scale_) \
+  (_Generic((type_)0, \
+    float: ChronoScaleFromFloat, \
+    double: ChronoScaleFromDouble, \
+    long double: ChronoScaleFromDouble, \
+    default: ChronoScaleApply)(&(scale_), (time_)))
+
+#else
+
+#define CHRONO_TICK_TO_TIME_(type_, ticks_, scale_) \
+  (CHRONO_IS_INTEGRAL_TYPE_(type_) ? \
+    ((type_)ChronoScaleApply(&(scale_), (uint64_t)(ticks_))) : \
+    ((sizeof(type_) == sizeof(float)) ? \
+      ((type_)ChronoScaleToFloat(&(scale_), (uint64_t)(ticks_))) : \
+      ((type_)ChronoScaleToDouble(&(scale_), (uint64_t)(ticks_)))))
+
+#define CHRONO_TIME_TO_TICK64_(type_, time_, scale_) \
+  (CHRONO_IS_INTEGRAL_TYPE_(type_) ? \
+    ChronoScaleApply(&(scale_), (uint64_t)(time_)) : \
+    ((sizeof(type_) == sizeof(float)) ? \
+      ChronoScaleFromFloat(&(scale_), (float)(time_)) : \
+      ChronoScaleFromDouble(&(scale_), (double)(time_))))
+
+#endif
+
+/**
+ * @brief CHRONO_TIME_TO_TICK64_() returns the 64-bit tick count. CHRONO_TIME_TO_TICK_() truncates it to chronoTick_t for the timeouts of the objects.
+ * 
+ */
+#define CHRONO_TIME_TO_TICK_(type_, time_, scale_) ((chronoTick_t)CHRONO_TIME_TO_TICK64_(type_, (time_), scale_))
+
+#define CHRONO_TICK_TO_S_(clock_, ticks_)  CHRONO_TICK_TO_TIME_(timeS_t, (ticks_), (clock_)->_tickToS)
+#define CHRONO_TICK_TO_MS_(clock_, ticks_) CHRONO_TICK_TO_TIME_(timeMs_t, (ticks_), (clock_)->_tickToMs)
+#define CHRONO_TICK_TO_US_(clock_, ticks_) CHRONO_TICK_TO_TIME_(timeUs_t, (ticks_), (clock_)->_tickToUs)
+
+/**
+ * @brief Converts a tick count to nanoseconds. The result is a 64-bit integer, so the resolution of the tick is kept.
+ * 
+ */
+#define CHRONO_TICK_TO_NS_(clock_, ticks_) ChronoScaleApply(&(clock_)->_tickToNs, (uint64_t)(ticks_))
+
+/**
+ * @brief Flags of the compact object. They are the two most significant bits of a chronoTick_t, and the rest is the value (timeout or expiry tick).
+ * 
+ */
+#define CHRONO_COMPACT_RUN_     ((chronoTick_t)((chronoTick_t)~(chronoTick_t)0 ^ (chronoTick_t)((chronoTick_t)~(chronoTick_t)0 >> 1)))
+#define CHRONO_COMPACT_TIMEOUT_ ((chronoTick_t)(CHRONO_COMPACT_RUN_ >> 1))
+#define CHRONO_COMPACT_VALUE_   ((chronoTick_t)(CHRONO_COMPACT_TIMEOUT_ - 1U))
+
+/**
+ * @brief Define assert macros of the inline functions.
+ * 
+ */
+#ifdef CHRONO_USE_FULL_ASSERT
+  #define CHRONO_ASSERT_(condition_) if(!(condition_)) {return;}
+  #define CHRONO_ASSERT_RETURN_(condition_, return_) if(!(condition_)) {return (return_);}
+#else
+  #define CHRONO_ASSERT_(condition_)
+  #define CHRONO_ASSERT_RETURN_(condition_, return_)
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+#ifdef CHRONO_INLINE
+/**
+ * @brief The default clock. It is defined in chrono.c.
+ * 
+ * @note This object is private. It is only visible to let the inline functions read it directly.
+ * 
+ */
+extern sChronoClock _chrono;
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+/**
+ * @brief Reads the host counter that is selected by CHRONO_TICK_HOST_SOURCE.
+ * 
+ * @note TICK_HOST_MONOTONIC_RAW and TICK_HOST_MONOTONIC_COARSE return clock_gettime() in nanoseconds. On Linux the call is served by the vDSO,
+ *       without a system call. The coarse clock is cheaper, but it only advances once per scheduler tick.
+ *       TICK_HOST_RDTSC and TICK_HOST_RDTSCP return the time stamp counter. RDTSCP waits for the previous instructions to finish, so it can't be
+ *       executed before the code that is measured. TICK_HOST_CNTVCT returns the virtual counter of the arm64 generic timer.
+ * 
+ * @note The counters are 64-bit and only their lower bits are kept if tick_t is narrower, which is why the top value must be 2^n-1.
+ * 
+ * @retval tick: Current value of the host counter
+ */
+static inline tick_t ChronoHostTick(void) {
+
+#if (CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_RAW) || (CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_COARSE)
+  struct timespec ts;
+  (void)clock_gettime((CHRONO_TICK_HOST_SOURCE == TICK_HOST_MONOTONIC_RAW) ? CLOCK_MONOTONIC_RAW : CLOCK_MONOTONIC_COARSE, &ts);
+  return (tick_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+#elif (CHRONO_TICK_HOST_SOURCE == TICK_HOST_RDTSC)
+  uint32_t lo;
+  uint32_t hi;
+  __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+  return (tick_t)(((uint64_t)hi << 32) | lo);
+#elif (CHRONO_TICK_HOST_SOURCE == TICK_HOST_RDTSCP)
+  uint32_t lo;
+  uint32_t hi;
+  __asm__ __volatile__("rdtscp" : "=a"(lo), "=d"(hi) : : "ecx");
+  return (tick_t)(((uint64_t)hi << 32) | lo);
+#else
+  uint64_t cnt;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(cnt));
+  return (tick_t)cnt;
+#endif
+}
+#endif
+
+/** @defgroup CHRONO_KERNEL Tick-level kernels of the chrono module
+ *  @brief These functions work on ticks of a clock and are shared by all functions of the chrono module.
+ *  @{
+ */
+
+/**
+ * @brief Converts a tick count to a time unit using the precomputed constants of the scale.
+ * 
+ * @note For tick counts that fit in 32 bits, the result is computed with two 32x32 bit multiplications and no division.
+ *       Larger tick counts (i.e., when tick_t is a 64-bit type or CHRONO_TICK_EXTENSION is defined) and scales with a ratio wider than
+ *       32 bits fall back to an exact division.
+ * 
+ * @param me Pointer to the scale object
+ * @param ticks Tick count
+ * @retval time: floor(ticks * Num / Den)
+ */
+static inline uint64_t ChronoScaleApply(sChronoScale const * const me, uint64_t ticks) {
+
+  if((ticks | me->_wide) > (uint64_t)UINT32_MAX) {
+    return ((ticks / me->_den) * me->_num) + (((ticks % me->_den) * me->_num) / me->_den); /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t lo = (ticks * (uint32_t)me->_mul) >> 32;
+  uint64_t hi = ticks * (uint32_t)(me->_mul >> 32);
+
+  return (hi + lo) >> (me->_shift - 32U);
+}
+
+/**
+ * @brief Converts a tick count to a float time unit with one multiplication by the ratio of the scale.
+ * 
+ * @param me Pointer to the scale object
+ * @param ticks Tick count
+ * @retval time: ticks * Num / Den
+ */
+static inline float ChronoScaleToFloat(sChronoScale const * const me, uint64_t ticks) {
+
+  return (float)ticks * me->_ratio._f;
+}
+
+/**
+ * @brief Converts a tick count to a double time unit with one multiplication by the ratio of the scale.
+ * 
+ * @param me Pointer to the scale object
+ * @param ticks Tick count
+ * @retval time: ticks * Num / Den
+ */
+static inline double ChronoScaleToDouble(sChronoScale const * const me, uint64_t ticks) {
+
+  return (double)ticks * me->_ratio._d;
+}
+
+/**
+ * @brief Converts a float time to a tick count with one multiplication by the ratio of the scale.
+ * 
+ * @note The ratio of the scales that convert to ticks is rounded up by one step of its precision, so an exact tick count is not truncated to the tick before it.
+ * 
+ * @param me Pointer to the scale object
+ * @param time Time in the unit of the scale
+ * @retval ticks: floor(time * Num / Den)
+ */
+static inline uint64_t ChronoScaleFromFloat(sChronoScale const * const me, float time) {
+
+  return (uint64_t)(time * me->_ratio._f);
+}
+
+/**
+ * @brief Converts a double time to a tick count with one multiplication by the ratio of the scale.
+ * 
+ * @note Same as ChronoScaleFromFloat() in double precision.
+ * 
+ * @param me Pointer to the scale object
+ * @param time Time in the unit of the scale
+ * @retval ticks: floor(time * Num / Den)
+ */
+static inline uint64_t ChronoScaleFromDouble(sChronoScale const * const me, double time) {
+
+  return (uint64_t)(time * me->_ratio._d);
+}
+
+#if defined(__cplusplus)
+extern "C++" {
+
+/**
+ * @brief Conversion kernels of a time type, selected at compile time by CHRONO_TICK_TO_TIME_() and CHRONO_TIME_TO_TICK_() in C++.
+ * 
+ */
+template<typename T>
+struct ChronoScaleKernel {
+
+  static inline T ToTime(sChronoScale const * const me, uint64_t ticks) {
+    return (T)ChronoScaleApply(me, ticks);
+  }
+
+  static inline uint64_t ToTick(sChronoScale const * const me, T time) {
+    return ChronoScaleApply(me, (uint64_t)time);
+  }
+};
+
+template<>
+struct ChronoScaleKernel<float> {
+
+  static inline float ToTime(sChronoScale const * const me, uint64_t ticks) {
+    return ChronoScaleToFloat(me, ticks);
+  }
+
+  static inline uint64_t ToTick(sChronoScale const * const me, float time) {
+    return ChronoScaleFromFloat(me, time);
+  }
+};
+
+template<>
+struct ChronoScaleKernel<double> {
+
+  static inline double ToTime(sChronoScale const * const me, uint64_t ticks) {
+    return ChronoScaleToDouble(me, ticks);
+  }
+
+  static inline uint64_t ToTick(sChronoScale const * const me, double time) {
+    return ChronoScaleFromDouble(me, time);
+  }
+};
+
+template<>
+struct ChronoScaleKernel<long double> {
+
+  static inline long double ToTime(sChronoScale const * const me, uint64_t ticks) {
+    return (long double)ChronoScaleToDouble(me, ticks);
+  }
+
+  static inline uint64_t ToTick(sChronoScale const * const me, long double time) {
+    return ChronoScaleFromDouble(me, (double)time);
+  }
+};
+
+}
+#endif
+
+/**
+ * @brief Reads the 64-bit tick of the clock and publishes it as the new snapshot of the timebase.
+ * 
+ * @note The reader copies the active slot and the current tick, and retries only if a new snapshot was published meanwhile.
+ *       It never waits for a preempted writer, because the active slot is not modified while a writer is filling the other one.
+ *       Publishing is optional: if another context is writing, the new snapshot is dropped and the next call publishes it.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counter mode of the clock
+ * @retval tick64: Ticks since the initialization of the clock
+ */
+static inline uint64_t ChronoClockTick64(sChronoClock const * const clock, uint8_t type, uint8_t mode) {
+
+  /* The timebase is the only state of the clock that changes after the initialization. Clocks are initialized at run time,
+     so they are never const objects. */
+  sChronoTimebase * const timebase = (sChronoTimebase *)&clock->_timebase; /* MISRA 2012 Rule 11.8 deviation */
+  sChronoTimebaseSlot volatile *slot;
+  uint32_t seq;
+  uint64_t ticks;
+  tick_t lastTick;
+  tick_t tick;
+
+  do {
+    seq = timebase->_seq;
+    CHRONO_TIMEBASE_BARRIER_();
+
+    slot = &timebase->_slot[(seq >> 1U) & 1U];
+    ticks = slot->_ticks;
+    lastTick = slot->_lastTick;
+    tick = CHRONO_GET_TICK_(clock, type);
+
+    CHRONO_TIMEBASE_BARRIER_();
+  } while(timebase->_seq != seq);
+
+  ticks += (uint64_t)CHRONO_ELAPSED_(clock, mode, tick, lastTick);
+
+  if(((seq & 1U) == 0U) && CHRONO_TIMEBASE_CLAIM_(timebase, seq)) {
+    CHRONO_TIMEBASE_BARRIER_();
+
+    slot = &timebase->_slot[((seq >> 1U) + 1U) & 1U];
+    slot->_ticks = ticks;
+    slot->_lastTick = tick;
+
+    CHRONO_TIMEBASE_BARRIER_();
+    timebase->_seq = seq + 2U;
+  }
+
+  return ticks;
+}
+
+/**
+ * @brief Returns the tick that chrono objects tag: the 64-bit tick if CHRONO_TICK_EXTENSION is defined, otherwise the raw tick.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @retval tick: Current tick of the chrono objects
+ */
+static inline chronoTick_t ChronoClockNow(sChronoClock const * const clock, uint8_t type, uint8_t mode) {
+
+#ifdef CHRONO_TICK_EXTENSION
+  return ChronoClockTick64(clock, type, mode);
+#else
+  (void)mode;
+
+  return CHRONO_GET_TICK_(clock, type);
+#endif
+}
+
+/**
+ * @brief Puts the chrono object in the run state and tags the current tick of the clock.
+ * 
+ * @note The kernel functions below take the tick type and counting mode as separate arguments. The default clock passes
+ *       compile-time constants (see CHRONO_DEFAULT_CLOCK_), so after inlining, the other tick type and counting mode are removed.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ */
+static inline void ChronoClockStart(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me) {
+
+  me->_startTick = ChronoClockNow(clock, type, mode);
+  me->_run = TRUE;
+}
+
+/**
+ * @brief Puts the chrono object in the stop state and tags the current tick of the clock.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ */
+static inline void ChronoClockStop(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me) {
+
+  me->_stopTick = ChronoClockNow(clock, type, mode);
+  me->_run = FALSE;
+  me->_isTimeout = FALSE;
+}
+
+/**
+ * @brief Returns the elapsed ticks since the start of the chrono object, or between its start and stop if it is stopped.
+ * 
+ * @note With CHRONO_OVERHEAD_COMPENSATION, the ticks of an empty measurement (see fChronoClock_GetElapsedOverheadTick()) are subtracted.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @retval elapsedTick: Elapsed ticks
+ */
+static inline chronoTick_t ChronoClockElapsedTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono const * const me) {
+
+  chronoTick_t elapsedTick;
+
+  if(!me->_run) {
+    elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, me->_stopTick, me->_startTick);
+  } else {
+    chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+    elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, me->_startTick);
+  }
+
+#ifdef CHRONO_OVERHEAD_COMPENSATION
+  elapsedTick = (elapsedTick > clock->_elapsedOverhead) ? (chronoTick_t)(elapsedTick - clock->_elapsedOverhead) : (chronoTick_t)0U;
+#endif
+
+  return elapsedTick;
+}
+
+/**
+ * @brief Updates the timeout state of the chrono object and returns the elapsed ticks if there is time left.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @param elapsedTick Elapsed ticks since the start. It is only valid when the function returns TRUE.
+ * @retval isLeft: FALSE if the chrono object is stopped or timed out.
+ */
+static inline bool_t ChronoClockLeftTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me, chronoTick_t * const elapsedTick) {
+
+  if(!me->_run) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(me->_isTimeout) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  *elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, me->_startTick);
+  if(*elapsedTick >= (me->_timeout)) {
+    me->_isTimeout = TRUE;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @param timeoutTick Time length until the chrono object times out (ticks)
+ */
+static inline void ChronoClockStartTimeout(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me, chronoTick_t timeoutTick) {
+
+  me->_timeout = timeoutTick;
+  me->_isTimeout = FALSE;
+
+  ChronoClockStart(clock, type, mode, me);
+}
+
+/**
+ * @brief Returns the timeout status of the chrono object.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @retval isTimeout: TRUE if the chrono is timed out, otherwise returns FALSE
+ */
+static inline bool_t ChronoClockIsTimeout(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me) {
+
+  if(!me->_run) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(me->_isTimeout) {
+    return TRUE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  if(CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, me->_startTick) >= me->_timeout) {
+    me->_isTimeout = TRUE;
+  } else {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Returns the tick that is "ticks" after "tick" on the specified clock. It is the inverse of CHRONO_OBJ_ELAPSED_().
+ * 
+ * @param clock Pointer to the clock object
+ * @param mode Counting mode of the clock
+ * @param tick The tick to start from
+ * @param ticks Number of ticks to advance. With a raw tick, it must not be more than the top value of the clock.
+ * @retval tick: The advanced tick
+ */
+static inline chronoTick_t ChronoClockTickAdvance(sChronoClock const * const clock, uint8_t mode, chronoTick_t tick, chronoTick_t ticks) {
+
+#ifdef CHRONO_TICK_EXTENSION
+  (void)clock;
+  (void)mode;
+
+  return tick + ticks;
+#else
+  if(CHRONO_COUNTERMODE_(mode) == TICK_COUNTERMODE_UP) {
+    return (ticks > (clock->_tickTopValue - tick)) ? (tick_t)(ticks - (clock->_tickTopValue - tick)) : (tick_t)(tick + ticks);
+  }
+
+  return (ticks > tick) ? (tick_t)(tick + (clock->_tickTopValue - ticks)) : (tick_t)(tick - ticks);
+#endif
+}
+
+/**
+ * @brief Returns TRUE if a period of the chrono object is due and moves its start tick to the start of the next period.
+ * 
+ * @note The next period starts at the end of the current one, not at the tick of the call, so the lateness of the calls doesn't accumulate.
+ *       The division that counts the missed periods is only done when a period is due.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @param policy Overrun policy, one of CHRONO_OVERRUN_CATCH_UP, CHRONO_OVERRUN_SKIP or CHRONO_OVERRUN_COALESCE
+ * @param missed Receives the number of whole periods that were missed in addition to the due one. It can be NULL.
+ * @retval isDue: TRUE if a period is due
+ */
+static inline bool_t ChronoClockIsPeriodDue(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me, uint8_t policy, uint32_t * const missed) {
+
+  if((!me->_run) || (me->_timeout == 0U)) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  chronoTick_t elapsedTick = (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, me->_startTick);
+  if(elapsedTick < me->_timeout) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t periods = elapsedTick / me->_timeout;
+
+  if(policy == CHRONO_OVERRUN_SKIP) {
+    me->_startTick = ChronoClockTickAdvance(clock, mode, me->_startTick, periods * me->_timeout);
+  } else if(policy == CHRONO_OVERRUN_COALESCE) {
+    me->_startTick = currentTick;
+  } else {
+    me->_startTick = ChronoClockTickAdvance(clock, mode, me->_startTick, me->_timeout);
+  }
+  me->_isTimeout = FALSE;
+
+  if(missed != NULL) {
+    *missed = ((periods - 1U) > (chronoTick_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)(periods - 1U);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Returns the ticks since the last call and moves the start tick of the chrono object to the current tick.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the chrono object
+ * @retval interval: Ticks between two consecutive calls, or 0 if the chrono object is stopped.
+ */
+static inline chronoTick_t ChronoClockIntervalTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChrono * const me) {
+
+  if(!me->_run) {
+    return (chronoTick_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  chronoTick_t startTick = me->_startTick;
+  me->_startTick = currentTick;
+
+  return (chronoTick_t)CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, startTick);
+}
+
+/**
+ * @brief Waits until the specified number of ticks passes since the start tick.
+ * 
+ * @note Between two tick reads, the loop waits with CHRONO_SPIN_WAIT_(), if CHRONO_SPIN_HINT() is defined in chrono_config.h.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param startTick Start tick of the delay
+ * @param delayTick Delay time length (ticks)
+ */
+static inline void ChronoClockDelayTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, chronoTick_t startTick, chronoTick_t delayTick) {
+
+  uint32_t backoff = 1U;
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  while(CHRONO_OBJ_ELAPSED_(clock, mode, currentTick, startTick) < delayTick) {
+    CHRONO_SPIN_WAIT_(backoff);
+    currentTick = ChronoClockNow(clock, type, mode);
+  }
+}
+
+/**
+ * @brief Starts the deadline object and computes its expiry tick.
+ * 
+ * @note With a raw tick, the expiry tick can be before the start tick if the tick generator overflows in between. This is detected here once,
+ *       so ChronoClockDeadlineReached() only compares the current tick with the expiry tick and the start tick.
+ *       With CHRONO_TICK_EXTENSION, the tick doesn't overflow and the expiry tick is simply the start tick plus the timeout.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the deadline object
+ * @param timeoutTick Time length until the deadline object times out (ticks)
+ */
+static inline void ChronoClockDeadlineStart(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoDeadline * const me, chronoTick_t timeoutTick) {
+
+#ifdef CHRONO_TICK_EXTENSION
+  me->_startTick = ChronoClockTick64(clock, type, mode);
+  me->_deadline = me->_startTick + timeoutTick;
+  me->_wrap = FALSE;
+#else
+  tick_t startTick = CHRONO_GET_TICK_(clock, type);
+
+  if(CHRONO_COUNTERMODE_(mode) == TICK_COUNTERMODE_UP) {
+    me->_wrap = (timeoutTick > (clock->_tickTopValue - startTick));
+    me->_deadline = me->_wrap ? (tick_t)(timeoutTick - (clock->_tickTopValue - startTick)) : (tick_t)(startTick + timeoutTick);
+  } else {
+    me->_wrap = (timeoutTick > startTick);
+    me->_deadline = me->_wrap ? (tick_t)(startTick + (clock->_tickTopValue - timeoutTick)) : (tick_t)(startTick - timeoutTick);
+  }
+  me->_startTick = startTick;
+#endif
+
+  me->_isTimeout = FALSE;
+  me->_run = TRUE;
+}
+
+/**
+ * @brief Returns TRUE if the current tick is at or after the expiry tick of the deadline object.
+ * 
+ * @note With a raw tick, the current tick has reached the expiry tick if it is beyond the expiry tick or it has overflowed back before the start tick.
+ *       If the overflow is a part of the timeout (_wrap), both conditions must hold.
+ * 
+ * @param clock Pointer to the clock object
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the deadline object
+ * @param currentTick Current tick of the clock
+ * @retval isReached: TRUE if the deadline is reached
+ */
+static inline bool_t ChronoClockDeadlineReached(sChronoClock const * const clock, uint8_t mode, sChronoDeadline const * const me, chronoTick_t currentTick) {
+
+  (void)clock;
+
+#ifdef CHRONO_TICK_EXTENSION
+  (void)mode;
+
+  return (currentTick >= me->_deadline);
+#else
+  bool_t isReached;
+  bool_t isOverflowed;
+
+  if(CHRONO_COUNTERMODE_(mode) == TICK_COUNTERMODE_UP) {
+    isReached = (currentTick >= me->_deadline);
+    isOverflowed = (currentTick < me->_startTick);
+  } else {
+    isReached = (currentTick <= me->_deadline);
+    isOverflowed = (currentTick > me->_startTick);
+  }
+
+  return me->_wrap ? (isReached && isOverflowed) : (isReached || isOverflowed);
+#endif
+}
+
+/**
+ * @brief Returns the timeout status of the deadline object.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the deadline object
+ * @retval isTimeout: TRUE if the deadline object is timed out, otherwise returns FALSE
+ */
+static inline bool_t ChronoClockDeadlineIsTimeout(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoDeadline * const me) {
+
+  if(!me->_run) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(me->_isTimeout) {
+    return TRUE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->_isTimeout = ChronoClockDeadlineReached(clock, mode, me, ChronoClockNow(clock, type, mode));
+
+  return me->_isTimeout;
+}
+
+/**
+ * @brief Updates the timeout state of the deadline object and returns the ticks left until its expiry tick.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the deadline object
+ * @param leftTick Ticks until the expiry tick. It is only valid when the function returns TRUE.
+ * @retval isLeft: FALSE if the deadline object is stopped or timed out.
+ */
+static inline bool_t ChronoClockDeadlineLeftTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoDeadline * const me, chronoTick_t * const leftTick) {
+
+  if(!me->_run) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(me->_isTimeout) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  chronoTick_t currentTick = ChronoClockNow(clock, type, mode);
+  if(ChronoClockDeadlineReached(clock, mode, me, currentTick)) {
+    me->_isTimeout = TRUE;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+#ifdef CHRONO_TICK_EXTENSION
+  *leftTick = me->_deadline - currentTick;
+#else
+  /* A timeout of one full period puts the expiry tick on the start tick, so being on it without reaching the deadline means a full period is left. */
+  *leftTick = (currentTick == me->_deadline) ? clock->_tickTopValue : CHRONO_ELAPSED_(clock, mode, me->_deadline, currentTick);
+#endif
+
+  return TRUE;
+}
+
+/**
+ * @brief Returns the flag word of the compact object. It is the expiry tick with CHRONO_TICK_EXTENSION and the timeout otherwise.
+ * 
+ */
+#ifdef CHRONO_TICK_EXTENSION
+  #define CHRONO_COMPACT_WORD_(me_) ((me_)->_deadline)
+#else
+  #define CHRONO_COMPACT_WORD_(me_) ((me_)->_timeout)
+#endif
+
+/**
+ * @brief Starts the compact object.
+ * 
+ * @note The timeout must not be longer than CHRONO_COMPACT_VALUE_ ticks, because the flags take the two most significant bits of the word.
+ *       With CHRONO_TICK_EXTENSION the expiry tick must not be above it either. Otherwise the compact object is stopped and the function returns FALSE.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the compact object
+ * @param timeoutTick Time length until the compact object times out (ticks)
+ * @retval isStarted: FALSE if the timeout doesn't fit in the compact object, otherwise returns TRUE
+ */
+static inline bool_t ChronoClockCompactStart(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoCompact * const me, uint64_t timeoutTick) {
+
+  if(timeoutTick > (uint64_t)CHRONO_COMPACT_VALUE_) {
+    CHRONO_COMPACT_WORD_(me) = (chronoTick_t)0;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+#ifdef CHRONO_TICK_EXTENSION
+  chronoTick_t startTick = ChronoClockTick64(clock, type, mode);
+  if((startTick > CHRONO_COMPACT_VALUE_) || ((CHRONO_COMPACT_VALUE_ - startTick) < (chronoTick_t)timeoutTick)) {
+    me->_deadline = (chronoTick_t)0;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->_deadline = (startTick + (chronoTick_t)timeoutTick) | CHRONO_COMPACT_RUN_;
+#else
+  me->_startTick = ChronoClockNow(clock, type, mode);
+  me->_timeout = (chronoTick_t)timeoutTick | CHRONO_COMPACT_RUN_;
+#endif
+
+  return TRUE;
+}
+
+/**
+ * @brief Updates the timeout state of the compact object and returns the ticks left until it times out.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the compact object
+ * @param leftTick Ticks until timeout. It is only valid when the function returns TRUE.
+ * @retval isLeft: FALSE if the compact object is stopped or timed out.
+ */
+static inline bool_t ChronoClockCompactLeftTick(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoCompact * const me, chronoTick_t * const leftTick) {
+
+  chronoTick_t word = CHRONO_COMPACT_WORD_(me);
+
+  if((word & (CHRONO_COMPACT_RUN_ | CHRONO_COMPACT_TIMEOUT_)) != CHRONO_COMPACT_RUN_) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+#ifdef CHRONO_TICK_EXTENSION
+  chronoTick_t currentTick = ChronoClockTick64(clock, type, mode);
+  chronoTick_t deadline = word & CHRONO_COMPACT_VALUE_;
+  if(currentTick >= deadline) {
+    CHRONO_COMPACT_WORD_(me) = word | CHRONO_COMPACT_TIMEOUT_;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  *leftTick = deadline - currentTick;
+#else
+  chronoTick_t timeout = word & CHRONO_COMPACT_VALUE_;
+  chronoTick_t elapsedTick = (chronoTick_t)CHRONO_ELAPSED_(clock, mode, ChronoClockNow(clock, type, mode), me->_startTick);
+  if(elapsedTick >= timeout) {
+    CHRONO_COMPACT_WORD_(me) = word | CHRONO_COMPACT_TIMEOUT_;
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  *leftTick = timeout - elapsedTick;
+#endif
+
+  return TRUE;
+}
+
+/**
+ * @brief Returns the timeout status of the compact object.
+ * 
+ * @param clock Pointer to the clock object
+ * @param type Tick type of the clock
+ * @param mode Counting mode of the clock
+ * @param me Pointer to the compact object
+ * @retval isTimeout: TRUE if the compact object is timed out, otherwise returns FALSE
+ */
+static inline bool_t ChronoClockCompactIsTimeout(sChronoClock const * const clock, uint8_t type, uint8_t mode, sChronoCompact * const me) {
+
+  chronoTick_t leftTick;
+
+  if((CHRONO_COMPACT_WORD_(me) & CHRONO_COMPACT_RUN_) == 0U) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return !ChronoClockCompactLeftTick(clock, type, mode, me, &leftTick);
+}
+
+/** @} */ //End of CHRONO_KERNEL
+
+#ifdef CHRONO_INLINE
+
+/** @defgroup INLINE_API Inline objective API
+ *  @brief Header-only versions of the hot functions of the default clock. They behave like the functions in chrono.c with the same names.
+ *  @{
+ */
+
+static inline tick_t fChrono_GetTick(void) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_GET_TICK_(&_chrono, CHRONO_TICK_TYPE);
+}
+
+static inline void fChrono_Start(sChrono * const me) {
+
+  CHRONO_ASSERT_(_chrono._init); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_(me != NULL);     /* MISRA 2012 Rule 15.5 deviation */
+
+  ChronoClockStart(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+static inline timeS_t fChrono_ElapsedS(sChrono const * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeS_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline timeMs_t fChrono_ElapsedMs(sChrono const * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeMs_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline timeUs_t fChrono_ElapsedUs(sChrono const * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeUs_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline uint64_t fChrono_ElapsedNs(sChrono const * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, 0U);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(&_chrono, ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline uint64_t fChrono_ElapsedTick(sChrono const * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, 0U);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockElapsedTick(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+static inline bool_t fChrono_IsTimeout(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, FALSE);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+static inline bool_t fChrono_DeadlineIsTimeout(sChronoDeadline * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, FALSE);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockDeadlineIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+static inline bool_t fChrono_CompactIsTimeout(sChronoCompact * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, FALSE);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return ChronoClockCompactIsTimeout(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+static inline timeS_t fChrono_IntervalS(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeS_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeS_t)0);     /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_S_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline timeMs_t fChrono_IntervalMs(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeMs_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_MS_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline timeUs_t fChrono_IntervalUs(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, (timeUs_t)0);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_US_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline uint64_t fChrono_IntervalNs(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, 0U);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return CHRONO_TICK_TO_NS_(&_chrono, ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me));
+}
+
+static inline uint64_t fChrono_IntervalTick(sChrono * const me) {
+
+  CHRONO_ASSERT_RETURN_(_chrono._init, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  CHRONO_ASSERT_RETURN_(me != NULL, 0U);    /* MISRA 2012 Rule 15.5 deviation */
+
+  return (uint64_t)ChronoClockIntervalTick(CHRONO_DEFAULT_CLOCK_, me);
+}
+
+/** @} */ //End of INLINE_API
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_INLINE_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -34,6 +34,13 @@ extern "C" {
  */
 #define TICK_TYPE_VARIABLE    (1U)
 #define TICK_TYPE_FUNCTION    (2U)
+#define TICK_TYPE_HOST        (3U)
+
+#define TICK_HOST_MONOTONIC_RAW     (1U)
+#define TICK_HOST_MONOTONIC_COARSE  (2U)
+#define TICK_HOST_RDTSC             (3U)
+#define TICK_HOST_RDTSCP            (4U)
+#define TICK_HOST_CNTVCT            (5U)
 
 #define TICK_COUNTERMODE_UP   (0U)
 #define TICK_COUNTERMODE_DOWN (1U)
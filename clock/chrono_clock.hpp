@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_clock.hpp
+  * @brief          : std::chrono compatible clock of the default clock of the chrono module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The C API returns timeUs_t, timeMs_t and timeS_t, whose types are selected in chrono_config.h, so C++ code needs casts and
+  unit conversions at each call. This header-only module describes the default clock as a std::chrono Clock instead.
+  The period of chrono::chrono_clock is the tick period of chrono_config.h as a std::ratio, so a std::chrono::duration_cast
+  to or from its duration is a compile-time constant and user code works with the standard durations without runtime scaling.
+
+  - Initialize the chrono module with fChrono_Init().
+  - chrono::chrono_clock::now() returns the 64-bit tick of the default clock (fChrono_GetTick64()) as a time_point.
+    It never overflows, so the clock is steady and time_points of any distance can be subtracted.
+  - chrono::to_ticks() converts any std::chrono::duration to a number of ticks, rounded up. For a constant duration it is a constant.
+  - chrono::start_timeout(), chrono::elapsed(), chrono::left() and chrono::delay() are the fChrono_xxx() functions with std::chrono durations.
+    start_timeout() returns false and doesn't start the object if the timeout is longer than max_timeout_ticks(), instead of truncating it.
+    delay() calls fChrono_DelayTicks(), so it sleeps, spins and compensates like the other delays and can be longer than the tick range.
+  - chrono::span() returns the raw tick difference of fChrono_TimeSpanTick() as a chrono::tick_duration, whose rep is tick_t.
+
+  @code
+  using namespace std::chrono_literals;
+
+  sChrono timeout;
+  (void)chrono::start_timeout(timeout, 250ms);    //No conversion at runtime
+  while(!fChrono_IsTimeout(&timeout)) {
+    //...
+  }
+
+  auto start = chrono::chrono_clock::now();
+  //User code that its execution time should be measured
+  //...
+  auto us = std::chrono::duration_cast<std::chrono::microseconds>(chrono::chrono_clock::now() - start);
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_CLOCK_HPP
+#define CHRONO_CLOCK_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201103L)
+#error "chrono_clock.hpp needs a C++11 compiler."
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+#include "..\chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Tick period of the default clock in nanoseconds as a ratio. It follows the same rules as chrono.c.
+ *
+ */
+#if defined(CHRONO_TICK_PERIOD_NUM) && defined(CHRONO_TICK_PERIOD_DEN)
+  #define CHRONO_CLOCK_PERIOD_NUM_  (CHRONO_TICK_PERIOD_NUM)
+  #define CHRONO_CLOCK_PERIOD_DEN_  (CHRONO_TICK_PERIOD_DEN)
+#else
+  #define CHRONO_CLOCK_PERIOD_NUM_  (CHRONO_TICK_TO_NANOSECOND_COEF)
+  #define CHRONO_CLOCK_PERIOD_DEN_  (1U)
+#endif
+
+namespace chrono {
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief std::chrono Clock of the default clock of the chrono module.
+  *
+  * @note rep is a signed 64-bit type because now() is built on fChrono_GetTick64() and differences of time_points may be negative.
+  *       period is the tick period of chrono_config.h in seconds.
+  *
+  */
+struct chrono_clock {
+
+  using rep = int64_t;
+  using period = std::ratio<(intmax_t)CHRONO_CLOCK_PERIOD_NUM_, (intmax_t)CHRONO_CLOCK_PERIOD_DEN_ * 1000000000>::type;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<chrono_clock>;
+
+  static constexpr bool is_steady = true;
+
+  /**
+   * @brief Returns the current time of the default clock.
+   *
+   * @retval time_point: Ticks of the default clock since fChrono_Init()
+   */
+  static time_point now() noexcept {
+    return time_point(duration((rep)fChrono_GetTick64()));
+  }
+};
+
+#if (__cplusplus < 201703L)
+constexpr bool chrono_clock::is_steady;
+#endif
+
+static_assert(CHRONO_CLOCK_PERIOD_NUM_ != 0, "chrono_clock needs a non-zero tick period in chrono_config.h file.");
+
+/**
+  * @brief Raw tick difference of the default clock. Its rep is tick_t, the type of the tick generator.
+  *
+  */
+using tick_duration = std::chrono::duration<tick_t, chrono_clock::period>;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Converts a duration to ticks of the default clock, rounded up. Negative durations give zero.
+ *
+ * @note The ratio between the units is resolved at compile time, and for a constant duration the result is a constant.
+ *
+ * @param time The duration
+ * @retval ticks: Number of ticks
+ */
+template<typename Rep, typename Period>
+constexpr uint64_t to_ticks(std::chrono::duration<Rep, Period> const time) noexcept {
+  return (time <= std::chrono::duration<Rep, Period>::zero()) ? 0U :
+         ((std::chrono::duration_cast<chrono_clock::duration>(time) < time) ?
+           ((uint64_t)std::chrono::duration_cast<chrono_clock::duration>(time).count() + 1U) :
+           (uint64_t)std::chrono::duration_cast<chrono_clock::duration>(time).count());
+}
+
+/**
+ * @brief Returns the longest timeout of a chrono object in ticks. Without CHRONO_TICK_EXTENSION it is the tick top value,
+ *        like fChrono_GetMaxMeasurableTimeUs(). With it, the timeout is a 64-bit tick.
+ *
+ * @retval ticks: Longest timeout (ticks)
+ */
+inline uint64_t max_timeout_ticks() noexcept {
+
+#ifdef CHRONO_TICK_EXTENSION
+  return UINT64_MAX;
+#else
+  return (uint64_t)fChrono_GetTickTopValue();
+#endif
+}
+
+/**
+ * @brief Same as fChrono_StartTimeoutUs() with a std::chrono duration.
+ *
+ * @param me Chrono object
+ * @param timeout Timeout of any std::chrono duration type
+ * @retval started: false if the timeout is longer than max_timeout_ticks(). The object is not changed then.
+ */
+template<typename Rep, typename Period>
+inline bool start_timeout(sChrono &me, std::chrono::duration<Rep, Period> const timeout) noexcept {
+
+  uint64_t ticks = to_ticks(timeout);
+  if(ticks > max_timeout_ticks()) {
+    return false; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  fChrono_StartTimeoutTicks(&me, ticks);
+
+  return true;
+}
+
+/**
+ * @brief Same as fChrono_ElapsedUs() as a duration of chrono_clock.
+ *
+ * @param me Chrono object
+ * @retval elapsed: Elapsed time since the start of the chrono object
+ */
+inline chrono_clock::duration elapsed(sChrono const &me) noexcept {
+  return chrono_clock::duration((chrono_clock::rep)fChrono_ElapsedTick(&me));
+}
+
+/**
+ * @brief Same as fChrono_LeftUs() as a duration of chrono_clock.
+ *
+ * @param me Chrono object
+ * @retval left: Time left until the timeout of the chrono object
+ */
+inline chrono_clock::duration left(sChrono &me) noexcept {
+  return chrono_clock::duration((chrono_clock::rep)fChrono_LeftTick(&me));
+}
+
+/**
+ * @brief Same as fChrono_TimeSpanTick() as a tick_duration.
+ *
+ * @param startTick Start tick
+ * @param endTick End tick
+ * @retval span: Tick difference between the two ticks
+ */
+inline tick_duration span(tick_t startTick, tick_t endTick) noexcept {
+  return tick_duration(fChrono_TimeSpanTick(startTick, endTick));
+}
+
+/**
+ * @brief Same as fChrono_DelayTicks() with a std::chrono duration. It blocks the program until the time passes.
+ *
+ * @param time Time to wait of any std::chrono duration type
+ */
+template<typename Rep, typename Period>
+inline void delay(std::chrono::duration<Rep, Period> const time) noexcept {
+  fChrono_DelayTicks(to_ticks(time));
+}
+
+}
+
+#endif /* CHRONO_CLOCK_HPP */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
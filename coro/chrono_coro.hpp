@@ -0,0 +1,469 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_coro.hpp
+  * @brief          : ChronoCoro C++20 coroutine layer of the chrono module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The ChronoCoro module lets C++20 code wait for a time or a condition with co_await instead of polling fChrono_IsTimeout()
+  in callbacks and state machines. It is header-only and needs a compiler with C++20 coroutine support. The C modules don't depend on it.
+
+  - Initialize the chrono module and the clock that drives the executor (fChrono_GetDefaultClock() returns the default clock).
+  - Create a chrono::executor and initialize it with init(). The resolution is the length of one step of its timing wheel
+    in ticks of the clock (see chrono_wheel.c). A coroutine wakes up on the first step boundary after its time.
+  - Write each timed flow as a function that returns chrono::task. Inside it, use:
+    - co_await chrono::sleep_for(us) to wait for "us" microseconds.
+    - co_await chrono::sleep_for_ticks(ticks) to wait for a number of ticks of the clock.
+    - co_await chrono::wait_until(pred, us) to wait until pred() returns true or "us" microseconds pass.
+      It returns true if pred() returned true and false on timeout.
+  - Pass each task to spawn(). The task runs at once until its first co_await.
+  - Call run_once() in the main loop. It resumes the coroutines whose time has come and the coroutines whose condition is true.
+
+  A suspended coroutine is parked on the timing wheel of the executor with a timer that lives in its own coroutine frame,
+  so the executor doesn't allocate memory and thousands of concurrent flows cost only their frames.
+  The executor is single-threaded. Spawn tasks and call run_once() from one context. The executor must outlive its tasks.
+  The coroutine frames are allocated with operator new. Exceptions that leave a task call std::terminate().
+
+  @code
+  static chrono::executor exec;
+  static bool rxReady;
+
+  static chrono::task Blink(void) {
+
+    while(true) {
+      //Turn the LED on
+      co_await chrono::sleep_for(100000);
+      //Turn the LED off
+      if(!co_await chrono::wait_until([] { return rxReady; }, 900000)) {
+        //Timeout
+      }
+    }
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    exec.init(fChrono_GetDefaultClock(), 1000);  //1000 ticks per step
+
+    exec.spawn(Blink());
+
+    while(1) {
+      exec.run_once();
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_CORO_HPP
+#define CHRONO_CORO_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+#error "chrono_coro.hpp needs a C++20 compiler."
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+#include "..\chrono.h"
+#include "..\wheel\chrono_wheel.h"
+
+namespace chrono {
+
+class executor;
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Coroutine type of the timed flows that run on a chrono::executor.
+  *
+  * @note A task starts suspended. executor::spawn() hands it over to the executor, and the frame is freed when the coroutine returns.
+  *       A task that is never spawned is destroyed with the task object.
+  *
+  */
+class task {
+public:
+
+  struct promise_type {
+
+    executor *_executor = nullptr;  /*!< Executor that runs the coroutine. This parameter is private. */
+
+    task get_return_object() noexcept {
+      return task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+
+    void return_void() noexcept;
+
+    void unhandled_exception() noexcept {
+      std::terminate();
+    }
+  };
+
+  task(task &&other) noexcept : _handle(std::exchange(other._handle, nullptr)) {
+  }
+
+  task(task const &) = delete;
+  task& operator=(task const &) = delete;
+  task& operator=(task &&) = delete;
+
+  ~task() {
+    if(_handle) {
+      _handle.destroy();
+    }
+  }
+
+private:
+
+  friend class executor;
+
+  explicit task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {
+  }
+
+  std::coroutine_handle<promise_type> _handle;  /*!< Handle of the coroutine until it is spawned. */
+};
+
+/**
+  * @brief State of one suspended coroutine. It is a member of the awaiter, so it lives in the coroutine frame.
+  *
+  * @note This type is private. Users must not create or change it.
+  *
+  */
+struct waiter {
+
+  sChronoWheelTimer _timer{};               /*!< Timer of the wheel that wakes the coroutine up. */
+
+  executor *_executor = nullptr;            /*!< Executor that parked the coroutine. */
+
+  std::coroutine_handle<> _handle;          /*!< Suspended coroutine. */
+
+  bool (*_poll)(void *) = nullptr;          /*!< Checks the condition of wait_until(), or nullptr for sleep_for(). */
+
+  void *_context = nullptr;                 /*!< Argument of _poll. */
+
+  waiter *_next = nullptr;                  /*!< Next waiter in the polling list of the executor. */
+
+  waiter *_prev = nullptr;                  /*!< Previous waiter in the polling list of the executor. */
+
+  bool _isTimeout = false;                  /*!< True if the coroutine was woken up by its timer. */
+};
+
+/**
+  * @brief Single-threaded executor that resumes the coroutines of chrono::task when their time or condition comes.
+  *
+  */
+class executor {
+public:
+
+  /**
+   * @brief Initializes the executor and its timing wheel.
+   *
+   * @param clock Pointer to the clock that drives the executor. It must be initialized.
+   * @param resolutionTick Number of clock ticks in one step of the timing wheel
+   * @retval chrono_res_t: Returns CHRONO_OK if initialization is successful, otherwise returns the error of fChronoWheel_Init().
+   */
+  chrono_res_t init(sChronoClock const * const clock, uint64_t resolutionTick) noexcept {
+
+    _polling = nullptr;
+    _count = 0U;
+
+    return fChronoWheel_Init(&_wheel, clock, resolutionTick);
+  }
+
+  /**
+   * @brief Hands the task over to the executor and runs it until its first co_await.
+   *
+   * @param newTask The task. It is moved into the executor.
+   */
+  void spawn(task &&newTask) noexcept {
+
+    std::coroutine_handle<task::promise_type> handle = std::exchange(newTask._handle, nullptr);
+    if(!handle) {
+      return; /* MISRA 2012 Rule 15.5 deviation */
+    }
+
+    handle.promise()._executor = this;
+    _count++;
+    handle.resume();
+  }
+
+  /**
+   * @brief Resumes the coroutines whose time has come, then the coroutines of wait_until() whose condition is true.
+   *
+   * @note Call it once per loop. Its cost is the cost of fChronoWheel_Advance() plus one call of each pending condition.
+   *
+   * @retval count: Number of coroutines that were resumed
+   */
+  uint32_t run_once() noexcept {
+
+    uint32_t count = fChronoWheel_Advance(&_wheel);
+
+    /* Waiters that are added by the resumed coroutines go to the front of the list, so they are checked in the next call. */
+    waiter *node = _polling;
+    while(node != nullptr) {
+      waiter *next = node->_next;
+
+      if(node->_poll(node->_context)) {
+        fChronoWheel_Cancel(&_wheel, &node->_timer);
+        Unlink(node);
+        node->_isTimeout = false;
+        count++;
+        node->_handle.resume();
+      }
+
+      node = next;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief Returns the number of spawned tasks that have not returned yet.
+   *
+   * @retval count: Number of tasks
+   */
+  uint32_t count() const noexcept {
+    return _count;
+  }
+
+  /**
+   * @brief Converts microseconds to ticks of the clock of the executor with fChronoClock_UsToTicks().
+   *        The result is 64-bit, so a wait can be longer than the tick range of the clock.
+   *
+   * @param us Time in microseconds
+   * @retval ticks: Number of ticks
+   */
+  uint64_t us_to_ticks(timeUs_t us) const noexcept {
+
+    return fChronoClock_UsToTicks(_wheel._clock, us);
+  }
+
+  /**
+   * @brief Parks the coroutine of the waiter until its timer expires. Used by the awaiters.
+   *
+   * @param node Pointer to the waiter
+   * @param ticks Number of clock ticks to wait
+   */
+  void park(waiter * const node, uint64_t ticks) noexcept {
+
+    node->_executor = this;
+    node->_isTimeout = false;
+    fChronoWheel_Arm(&_wheel, &node->_timer, ticks, Expire, node);
+
+    if(node->_poll != nullptr) {
+      node->_prev = nullptr;
+      node->_next = _polling;
+      if(_polling != nullptr) {
+        _polling->_prev = node;
+      }
+      _polling = node;
+    }
+  }
+
+private:
+
+  friend struct task::promise_type;
+
+  /**
+   * @brief Callback of the timers of the waiters. It resumes the coroutine of the waiter.
+   *
+   * @note The wheel disarms the timer before this call and doesn't touch it afterwards, so the coroutine may return and free its frame.
+   *
+   */
+  static void Expire(sChronoWheelTimer * const timer, void *arg) noexcept {
+
+    (void)timer;
+    waiter *node = static_cast<waiter*>(arg);
+
+    node->_isTimeout = true;
+    if(node->_poll != nullptr) {
+      node->_executor->Unlink(node);
+    }
+    node->_handle.resume();
+  }
+
+  /**
+   * @brief Removes the waiter from the polling list.
+   *
+   */
+  void Unlink(waiter * const node) noexcept {
+
+    if(node->_prev != nullptr) {
+      node->_prev->_next = node->_next;
+    } else {
+      _polling = node->_next;
+    }
+    if(node->_next != nullptr) {
+      node->_next->_prev = node->_prev;
+    }
+    node->_next = nullptr;
+    node->_prev = nullptr;
+  }
+
+  sChronoWheel _wheel{};        /*!< Timing wheel of the parked coroutines. */
+
+  waiter *_polling = nullptr;   /*!< List of the coroutines of wait_until() whose condition is checked in each run_once(). */
+
+  uint32_t _count = 0U;         /*!< Number of spawned tasks that have not returned yet. */
+};
+
+/**
+ * @brief Called when the coroutine of a task returns. The frame is freed right after it.
+ *
+ */
+inline void task::promise_type::return_void() noexcept {
+
+  if(_executor != nullptr) {
+    _executor->_count--;
+  }
+}
+
+/**
+  * @brief Awaiter of sleep_for() and sleep_for_ticks().
+  *
+  */
+class sleep_awaiter {
+public:
+
+  sleep_awaiter(uint64_t ticks, timeUs_t us, bool isUs) noexcept : _ticks(ticks), _us(us), _isUs(isUs) {
+  }
+
+  bool await_ready() const noexcept {
+    return _isUs ? (_us <= (timeUs_t)0) : (_ticks == 0U);
+  }
+
+  void await_suspend(std::coroutine_handle<task::promise_type> handle) noexcept {
+
+    executor *owner = handle.promise()._executor;
+
+    _waiter._handle = handle;
+    owner->park(&_waiter, _isUs ? owner->us_to_ticks(_us) : _ticks);
+  }
+
+  void await_resume() const noexcept {
+  }
+
+private:
+
+  uint64_t _ticks;  /*!< Time to wait in ticks, if _isUs is false. */
+
+  timeUs_t _us;     /*!< Time to wait in microseconds, if _isUs is true. It keeps the fraction of a floating point time type. */
+
+  bool _isUs;       /*!< True if _us holds the time to wait. */
+
+  waiter _waiter;   /*!< State of the suspended coroutine. */
+};
+
+/**
+  * @brief Awaiter of wait_until(). co_await returns true if the condition became true and false on timeout.
+  *
+  */
+template<typename Pred>
+class wait_awaiter {
+public:
+
+  wait_awaiter(Pred pred, timeUs_t timeoutUs) noexcept : _pred(std::move(pred)), _timeoutUs(timeoutUs) {
+  }
+
+  bool await_ready() {
+    return static_cast<bool>(_pred());
+  }
+
+  void await_suspend(std::coroutine_handle<task::promise_type> handle) noexcept {
+
+    executor *owner = handle.promise()._executor;
+
+    _waiter._handle = handle;
+    _waiter._poll = Poll;
+    _waiter._context = this;
+    owner->park(&_waiter, owner->us_to_ticks(_timeoutUs));
+  }
+
+  bool await_resume() const noexcept {
+    return !_waiter._isTimeout;
+  }
+
+private:
+
+  /**
+   * @brief Calls the condition of the awaiter that holds the waiter.
+   *
+   */
+  static bool Poll(void *context) {
+
+    return static_cast<bool>(static_cast<wait_awaiter*>(context)->_pred());
+  }
+
+  Pred _pred;           /*!< The condition. */
+
+  timeUs_t _timeoutUs;  /*!< Timeout in microseconds. */
+
+  waiter _waiter;       /*!< State of the suspended coroutine. */
+};
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Suspends the task for the specified time.
+ *
+ * @param us Time in microseconds
+ * @retval awaiter: Use it with co_await.
+ */
+inline sleep_awaiter sleep_for(timeUs_t us) noexcept {
+  return sleep_awaiter(0U, us, true);
+}
+
+/**
+ * @brief Suspends the task for the specified number of ticks of the clock of the executor.
+ *
+ * @param ticks Number of ticks
+ * @retval awaiter: Use it with co_await.
+ */
+inline sleep_awaiter sleep_for_ticks(uint64_t ticks) noexcept {
+  return sleep_awaiter(ticks, (timeUs_t)0, false);
+}
+
+/**
+ * @brief Suspends the task until the condition is true or the timeout expires.
+ *
+ * @note The condition is checked before the task is suspended and then once in each executor::run_once().
+ *
+ * @param pred The condition. It is called without arguments and returns a value that converts to bool.
+ * @param timeoutUs Timeout in microseconds
+ * @retval awaiter: Use it with co_await. co_await returns true if the condition became true and false on timeout.
+ */
+template<typename Pred>
+inline wait_awaiter<Pred> wait_until(Pred pred, timeUs_t timeoutUs) {
+  return wait_awaiter<Pred>(std::move(pred), timeoutUs);
+}
+
+}
+
+#endif /* CHRONO_CORO_HPP */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
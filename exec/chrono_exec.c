@@ -0,0 +1,356 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_exec.c
+  * @brief          : ChronoExec module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The ChronoExec module is a table-driven cooperative executor for periodic tasks. Instead of RUN_EVERY blocks with their own
+  static chrono objects spread over the application, all periodic tasks are registered in one table and one call dispatches them.
+  The executor also measures each task, so the CPU load of the periodic jobs can be profiled and balanced.
+
+  - Initialize the chrono module and the clock that drives the executor (fChrono_GetDefaultClock() returns the default clock).
+  - Provide an array of sChronoExecTask for the table and initialize the executor with fChronoExec_Init().
+  - Register each task with fChronoExec_Add(). It takes the period in ticks, the priority and the function of the task.
+    The first run is one period after the task is added.
+  - In the main loop, call fChronoExec_Run(). It calls the functions of the due tasks in the order of their deadlines.
+    Between tasks with the same deadline, the task with the higher priority runs first.
+  - A task keeps its phase. If it starts more than one period late, it runs once, the missed periods are skipped and counted as overruns.
+  - A task runs at most once in each call to fChronoExec_Run(), so a task that takes longer than its period can't starve the main loop.
+  - fChronoExec_GetStats() returns the number of runs and overruns, and the execution time and start lateness of each task.
+    The jitter of the start is LatenessMax - LatenessMin. fChronoExec_ResetStats() clears them.
+  - fChronoExec_Suspend() and fChronoExec_Resume() pause a task. A resumed task runs one period after it is resumed.
+  - fChronoExec_NextDeadlineTicks() returns the ticks until the next task is due, so the main loop can sleep until then.
+  - Dispatching scans the table, which is cheap for tens of tasks. For a large number of jobs, use the ChronoSched module.
+  - The module is not re-entrant. Use an executor from one context.
+
+  @code
+  static sChronoExecTask table[4];
+  static sChronoExec exec;
+
+  static void ControlLoop(void *arg) {
+    //Run the controller
+    //...
+  }
+
+  static void Telemetry(void *arg) {
+    //Send the telemetry
+    //...
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    fChronoExec_Init(&exec, fChrono_GetDefaultClock(), table, 4);
+    sChronoExecTask *control = fChronoExec_Add(&exec, 1000, 10, ControlLoop, NULL);
+    fChronoExec_Add(&exec, 100000, 1, Telemetry, NULL);
+
+    while(1) {
+      fChronoExec_Run(&exec);
+
+      sChronoExecStats stats;
+      fChronoExec_GetStats(control, &stats);
+      //Check stats.ExecMax and stats.Overruns
+      //...
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_exec.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Define assert macros.
+ *
+ */
+#ifdef CHRONO_USE_FULL_ASSERT
+  #define ASSERT_(condition_) if(!(condition_)) {return;}
+  #define ASSERT_RETURN_(condition_, return_) if(!(condition_)) {return (return_);}
+#else
+  #define ASSERT_(condition_)
+  #define ASSERT_RETURN_(condition_, return_)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static sChronoExecTask* NextDue(sChronoExec const * const me, uint64_t tick);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the executor.
+ *
+ * @param me Pointer to the executor object
+ * @param clock Pointer to the clock that drives the executor. It must be initialized.
+ * @param table Array that holds the tasks
+ * @param capacity Number of tasks in the table
+ * @retval chrono_res_t: Returns CHRONO_OK if initialization is successful, otherwise returns error.
+ */
+chrono_res_t fChronoExec_Init(sChronoExec * const me, sChronoClock const * const clock, sChronoExecTask * const table, uint32_t capacity) {
+
+  if((me == NULL) || (clock == NULL) || (!clock->_init)) {
+    return CHRONO_EXEC_ERROR_CLOCK; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if((table == NULL) || (capacity == 0U)) {
+    return CHRONO_EXEC_ERROR_TABLE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->_clock = clock;
+  me->_table = table;
+  me->_capacity = capacity;
+  me->_count = 0U;
+
+  return CHRONO_OK;
+}
+
+/**
+ * @brief Registers a periodic task in the next free task of the table.
+ *
+ * @param me Pointer to the executor object
+ * @param periodTick Period of the task in ticks. It must not be zero.
+ * @param priority Priority of the task. Between tasks with the same deadline, the higher priority runs first.
+ * @param callback Function of the task
+ * @param arg Argument of the function
+ * @retval task: Pointer to the registered task, or NULL if the table is full or the parameters are invalid
+ */
+sChronoExecTask* fChronoExec_Add(sChronoExec * const me, uint64_t periodTick, uint8_t priority, fpChronoExecCallback_t callback, void *arg) {
+
+  ASSERT_RETURN_(me != NULL, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  if((me->_count >= me->_capacity) || (periodTick == 0U) || (callback == NULL)) {
+    return NULL;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  sChronoExecTask *task = &me->_table[me->_count];
+
+  task->_period = periodTick;
+  task->_deadline = fChronoClock_GetTick64(me->_clock) + periodTick;
+  task->_callback = callback;
+  task->_arg = arg;
+  task->_priority = priority;
+  task->_active = TRUE;
+  fChronoExec_ResetStats(task);
+
+  me->_count++;
+
+  return task;
+}
+
+/**
+ * @brief Suspends the task. It doesn't run until it is resumed.
+ *
+ * @param task Pointer to the task object
+ */
+void fChronoExec_Suspend(sChronoExecTask * const task) {
+
+  ASSERT_(task != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  task->_active = FALSE;
+}
+
+/**
+ * @brief Resumes the suspended task. Its next run is one period after this call. Resuming an active task has no effect.
+ *
+ * @param me Pointer to the executor object
+ * @param task Pointer to the task object
+ */
+void fChronoExec_Resume(sChronoExec const * const me, sChronoExecTask * const task) {
+
+  ASSERT_(me != NULL);   /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_(task != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(!task->_active) {
+    task->_deadline = fChronoClock_GetTick64(me->_clock) + task->_period;
+    task->_active = TRUE;
+  }
+}
+
+/**
+ * @brief Calls the functions of the due tasks in the order of their deadlines and updates their statistics.
+ *
+ * @note Only the tasks that are due when this function is called run, and each of them runs once.
+ *       The next deadline of a task is set before its function is called, so the function can suspend the task.
+ *
+ * @param me Pointer to the executor object
+ * @retval count: Number of tasks that ran
+ */
+uint32_t fChronoExec_Run(sChronoExec * const me) {
+
+  uint32_t count = 0U;
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  uint64_t runTick = fChronoClock_GetTick64(me->_clock);
+  sChronoExecTask *task = NextDue(me, runTick);
+
+  while(task != NULL) {
+    sChronoExecStats *stats = &task->_stats;
+    uint64_t startTick = fChronoClock_GetTick64(me->_clock);
+    uint64_t lateness = startTick - task->_deadline;
+    uint64_t missed = lateness / task->_period;
+
+    task->_deadline += task->_period * (missed + 1U);
+    stats->Overruns = (missed > (uint64_t)(UINT32_MAX - stats->Overruns)) ? UINT32_MAX : (stats->Overruns + (uint32_t)missed);
+
+    task->_callback(task->_arg);
+
+    uint64_t exec = fChronoClock_GetTick64(me->_clock) - startTick;
+
+    if((stats->Runs == 0U) || (exec < stats->ExecMin)) {
+      stats->ExecMin = exec;
+    }
+    if(exec > stats->ExecMax) {
+      stats->ExecMax = exec;
+    }
+    if((stats->Runs == 0U) || (lateness < stats->LatenessMin)) {
+      stats->LatenessMin = lateness;
+    }
+    if(lateness > stats->LatenessMax) {
+      stats->LatenessMax = lateness;
+    }
+    stats->ExecLast = exec;
+    stats->ExecTotal += exec;
+    stats->LatenessTotal += lateness;
+    stats->Runs++;
+
+    count++;
+    task = NextDue(me, runTick);
+  }
+
+  return count;
+}
+
+/**
+ * @brief Returns the number of ticks until the next task is due.
+ *
+ * @param me Pointer to the executor object
+ * @retval ticks: Ticks until the next deadline, or CHRONO_EXEC_NO_DEADLINE if no task is active
+ */
+uint64_t fChronoExec_NextDeadlineTicks(sChronoExec const * const me) {
+
+  uint64_t deadline = CHRONO_EXEC_NO_DEADLINE;
+
+  ASSERT_RETURN_(me != NULL, CHRONO_EXEC_NO_DEADLINE); /* MISRA 2012 Rule 15.5 deviation */
+
+  for(uint32_t i = 0U; i < me->_count; i++) {
+    if(me->_table[i]._active && (me->_table[i]._deadline < deadline)) {
+      deadline = me->_table[i]._deadline;
+    }
+  }
+
+  if(deadline == CHRONO_EXEC_NO_DEADLINE) {
+    return CHRONO_EXEC_NO_DEADLINE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t now = fChronoClock_GetTick64(me->_clock);
+
+  return (deadline > now) ? (deadline - now) : 0U;
+}
+
+/**
+ * @brief Copies the statistics of the task.
+ *
+ * @param task Pointer to the task object
+ * @param stats Pointer to the object that receives the statistics
+ */
+void fChronoExec_GetStats(sChronoExecTask const * const task, sChronoExecStats * const stats) {
+
+  ASSERT_(task != NULL);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_(stats != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  *stats = task->_stats;
+}
+
+/**
+ * @brief Clears the statistics of the task.
+ *
+ * @param task Pointer to the task object
+ */
+void fChronoExec_ResetStats(sChronoExecTask * const task) {
+
+  ASSERT_(task != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  task->_stats.Runs = 0U;
+  task->_stats.Overruns = 0U;
+  task->_stats.ExecLast = 0U;
+  task->_stats.ExecMin = 0U;
+  task->_stats.ExecMax = 0U;
+  task->_stats.ExecTotal = 0U;
+  task->_stats.LatenessMin = 0U;
+  task->_stats.LatenessMax = 0U;
+  task->_stats.LatenessTotal = 0U;
+}
+
+/**
+ * @brief Returns the number of registered tasks.
+ *
+ * @param me Pointer to the executor object
+ * @retval count: Number of registered tasks
+ */
+uint32_t fChronoExec_GetCount(sChronoExec const * const me) {
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return me->_count;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Returns the active task with the earliest deadline that is not after the tick. Ties go to the higher priority, then to the earlier task in the table.
+ *
+ * @param me Pointer to the executor object
+ * @param tick The tick that the deadlines are compared with
+ * @retval task: Pointer to the task, or NULL if no task is due
+ */
+static sChronoExecTask* NextDue(sChronoExec const * const me, uint64_t tick) {
+
+  sChronoExecTask *due = NULL;
+
+  for(uint32_t i = 0U; i < me->_count; i++) {
+    sChronoExecTask *task = &me->_table[i];
+
+    if(task->_active && (task->_deadline <= tick)) {
+      if((due == NULL) || (task->_deadline < due->_deadline) ||
+         ((task->_deadline == due->_deadline) && (task->_priority > due->_priority))) {
+        due = task;
+      }
+    }
+  }
+
+  return due;
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -0,0 +1,150 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_exec.h
+  * @brief          : ChronoExec module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_exec.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_EXEC_H
+#define CHRONO_EXEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "..\chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Result values of fChronoExec_Init() in addition to CHRONO_OK.
+ *
+ */
+#define CHRONO_EXEC_ERROR_CLOCK       (30U)
+#define CHRONO_EXEC_ERROR_TABLE       (31U)
+
+/**
+ * @brief Returned by fChronoExec_NextDeadlineTicks() when no task is active.
+ *
+ */
+#define CHRONO_EXEC_NO_DEADLINE       (UINT64_MAX)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Pointer to the function of a task.
+  *
+  */
+typedef void(*fpChronoExecCallback_t)(void *arg);
+
+/**
+  * @brief Run-time statistics of a task. All times are in ticks of the clock of the executor.
+  *
+  * @note Lateness is the time from the deadline of the task to the start of its function. The jitter of the start is LatenessMax - LatenessMin,
+  *       and the mean lateness and execution time are LatenessTotal / Runs and ExecTotal / Runs.
+  *
+  */
+typedef struct {
+
+  uint32_t Runs;            /*!< Number of times the function of the task was called. */
+
+  uint32_t Overruns;        /*!< Number of periods that were missed because the task started more than one period late. */
+
+  uint64_t ExecLast;        /*!< Execution time of the last run. */
+
+  uint64_t ExecMin;         /*!< Shortest execution time. */
+
+  uint64_t ExecMax;         /*!< Longest execution time. */
+
+  uint64_t ExecTotal;       /*!< Sum of the execution times. */
+
+  uint64_t LatenessMin;     /*!< Smallest lateness of the start. */
+
+  uint64_t LatenessMax;     /*!< Largest lateness of the start. */
+
+  uint64_t LatenessTotal;   /*!< Sum of the lateness of the starts. */
+}sChronoExecStats;
+
+/**
+  * @brief Definition of the task object of the executor.
+  *
+  * @note Tasks live in the table that the user gives to fChronoExec_Init(). fChronoExec_Add() fills the next free task of the table.
+  *
+  */
+typedef struct {
+
+  uint64_t _deadline;                 /*!< 64-bit tick of the clock at which the task is due. This parameter is private. */
+
+  uint64_t _period;                   /*!< Period of the task in ticks. This parameter is private. */
+
+  fpChronoExecCallback_t _callback;   /*!< Function of the task. This parameter is private. */
+
+  void *_arg;                         /*!< Argument of the function. This parameter is private. */
+
+  uint8_t _priority;                  /*!< Priority of the task. Between tasks with the same deadline, the higher priority runs first. This parameter is private. */
+
+  bool_t _active;                     /*!< FALSE if the task is suspended. This parameter is private. */
+
+  sChronoExecStats _stats;            /*!< Run-time statistics of the task. This parameter is private. */
+}sChronoExecTask;
+
+/**
+  * @brief Definition of the executor object.
+  *
+  */
+typedef struct {
+
+  sChronoClock const *_clock;         /*!< Clock that drives the executor. */
+
+  sChronoExecTask *_table;            /*!< Table of the tasks. */
+
+  uint32_t _capacity;                 /*!< Number of tasks in the table. */
+
+  uint32_t _count;                    /*!< Number of added tasks. */
+}sChronoExec;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+chrono_res_t fChronoExec_Init(sChronoExec * const me, sChronoClock const * const clock, sChronoExecTask * const table, uint32_t capacity);
+sChronoExecTask* fChronoExec_Add(sChronoExec * const me, uint64_t periodTick, uint8_t priority, fpChronoExecCallback_t callback, void *arg);
+void fChronoExec_Suspend(sChronoExecTask * const task);
+void fChronoExec_Resume(sChronoExec const * const me, sChronoExecTask * const task);
+uint32_t fChronoExec_Run(sChronoExec * const me);
+uint64_t fChronoExec_NextDeadlineTicks(sChronoExec const * const me);
+void fChronoExec_GetStats(sChronoExecTask const * const task, sChronoExecStats * const stats);
+void fChronoExec_ResetStats(sChronoExecTask * const task);
+uint32_t fChronoExec_GetCount(sChronoExec const * const me);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_EXEC_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
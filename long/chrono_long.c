@@ -69,9 +69,7 @@
  */
 void fChronoLong_Start(sChronoLong * const me) {
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   me->_startTimeMs = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
 
   me->_run = TRUE;
 }
@@ -103,9 +101,7 @@ uint64_t fChronoLong_ElapsedS(sChronoLong const * const me) {
   
   uint64_t startTime = me->_startTimeMs;
   
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
 
   return (ELAPSED_(millis, startTime) / 1000U);
 }
@@ -124,9 +120,7 @@ uint64_t fChronoLong_ElapsedMs(sChronoLong const * const me) {
   
   uint64_t startTime = me->_startTimeMs;
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
   
   return ELAPSED_(millis, startTime);
 }
@@ -152,9 +146,7 @@ uint64_t fChronoLong_LeftS(sChronoLong * const me) {
     return (uint64_t)0;
   }
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
     
   uint64_t elapsed = (ELAPSED_(millis, startTime)) / (uint64_t)1000U;
   if(elapsed >= (me->_timeoutMs / (tick_t)1000U)) {
@@ -186,9 +178,7 @@ uint64_t fChronoLong_LeftMs(sChronoLong * const me) {
     return (timeMs_t)0;
   }
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
     
   uint64_t elapsed = ELAPSED_(millis, startTime);
   if(elapsed >= (me->_timeoutMs)) {
@@ -245,9 +235,7 @@ bool_t fChronoLong_IsTimeout(sChronoLong * const me) {
     return TRUE;
   }
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
   uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
 
   if(ELAPSED_(millis, startTime) >= me->_timeoutMs) {
     me->_isTimeout = TRUE;
@@ -26,14 +26,9 @@ extern "C" {
 
 /* Exported defines ----------------------------------------------------------*/
 /**
-  * @brief
-  *
-  * @note
-  *
-  * @note
+  * @note The ChronoLong module reads the time using millis_(), which is lock-free and re-entrant.
+  *       So CHRONO_LONG_CRITICAL_SECTION_ENTER_ and CHRONO_LONG_CRITICAL_SECTION_EXIT_ are not needed anymore.
   */
-#define CHRONO_LONG_CRITICAL_SECTION_ENTER_
-#define CHRONO_LONG_CRITICAL_SECTION_EXIT_
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,390 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_sched.c
+  * @brief          : ChronoSched module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The ChronoSched module is a deadline scheduler. It keeps periodic and one-shot jobs in a binary min-heap ordered by their deadline,
+  so the main loop can ask when the next job is due and sleep until then, instead of polling every RUN_EVERY block at 100% CPU.
+
+  - Initialize the chrono module and the clock that drives the scheduler (fChrono_GetDefaultClock() returns the default clock).
+  - Provide an array of sChronoSchedEntry pointers for the heap and initialize the scheduler with fChronoSched_Init().
+    The size of the array is the largest number of jobs that can be scheduled at the same time.
+  - Create a variable of type sChronoSchedEntry for each job and schedule it with fChronoSched_Start(). The job is due after
+    "delayTick" ticks, and then every "periodTick" ticks. A zero period makes it a one-shot job. fChronoSched_Stop() removes it.
+  - In the main loop, call fChronoSched_Run(). It calls the callbacks of the due jobs.
+    fChronoSched_RunNext() returns the due jobs one by one instead, for callers that call the callbacks themselves.
+  - fChronoSched_NextDeadlineTicks() returns the ticks until the next job is due. Sleep (hosted) or wait for interrupt (MCU)
+    for that long, e.g., by programming a wake-up timer.
+  - A periodic job keeps its phase. If fChronoSched_Run() is called late, the job runs once and the missed periods are skipped.
+  - Starting, stopping and running take O(log N) time. fChronoSched_NextDeadlineTicks() takes O(1) time.
+  - The scheduler reads fChronoClock_GetTick64(), so it works over any number of overflows of the tick generator.
+  - The module is not re-entrant. Use a scheduler from one context. Callbacks may start and stop entries of the same scheduler.
+
+  @code
+  static sChronoSchedEntry *heap[8];
+  static sChronoSched sched;
+  static sChronoSchedEntry ledJob;
+
+  static void LedToggle(sChronoSchedEntry * const entry, void *arg) {
+    //Toggle the LED
+    //...
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    fChronoSched_Init(&sched, fChrono_GetDefaultClock(), heap, 8);
+    fChronoSched_Start(&sched, &ledJob, 0, 500000, LedToggle, NULL);
+
+    while(1) {
+      fChronoSched_Run(&sched);
+
+      uint64_t sleepTicks = fChronoSched_NextDeadlineTicks(&sched);
+      //Program the wake-up timer with sleepTicks and execute WFI
+      //...
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_sched.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Define assert macros.
+ *
+ */
+#ifdef CHRONO_USE_FULL_ASSERT
+  #define ASSERT_(condition_) if(!(condition_)) {return;}
+  #define ASSERT_RETURN_(condition_, return_) if(!(condition_)) {return (return_);}
+#else
+  #define ASSERT_(condition_)
+  #define ASSERT_RETURN_(condition_, return_)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void Place(sChronoSched * const me, uint32_t position, sChronoSchedEntry * const entry);
+static void SiftUp(sChronoSched * const me, uint32_t position);
+static void SiftDown(sChronoSched * const me, uint32_t position);
+static void Remove(sChronoSched * const me, sChronoSchedEntry * const entry);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * @param me Pointer to the scheduler object
+ * @param clock Pointer to the clock that drives the scheduler. It must be initialized.
+ * @param heap Array that holds the scheduled entries
+ * @param capacity Number of elements in the heap array
+ * @retval chrono_res_t: Returns CHRONO_OK if initialization is successful, otherwise returns error.
+ */
+chrono_res_t fChronoSched_Init(sChronoSched * const me, sChronoClock const * const clock, sChronoSchedEntry ** const heap, uint32_t capacity) {
+
+  if((me == NULL) || (clock == NULL) || (!clock->_init)) {
+    return CHRONO_SCHED_ERROR_CLOCK;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if((heap == NULL) || (capacity == 0U)) {
+    return CHRONO_SCHED_ERROR_HEAP; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->_clock = clock;
+  me->_heap = heap;
+  me->_capacity = capacity;
+  me->_count = 0U;
+  me->_inRun = FALSE;
+  me->_runTick = 0U;
+
+  return CHRONO_OK;
+}
+
+/**
+ * @brief Schedules the entry. If the entry is already scheduled, it is scheduled again with the new times.
+ *
+ * @note If it is called from a callback with zero delay, the entry is due in the next call to fChronoSched_Run(), not in the current one.
+ *
+ * @param me Pointer to the scheduler object
+ * @param entry Pointer to the entry object
+ * @param delayTick Number of ticks until the entry is due for the first time
+ * @param periodTick Number of ticks between the next deadlines of the entry, or zero for a one-shot entry
+ * @param callback Function that is called when the entry is due
+ * @param arg Argument of the callback
+ * @retval isScheduled: FALSE if the heap is full
+ */
+bool_t fChronoSched_Start(sChronoSched * const me, sChronoSchedEntry * const entry, uint64_t delayTick, uint64_t periodTick, fpChronoSchedCallback_t callback, void *arg) {
+
+  ASSERT_RETURN_(me != NULL, FALSE);    /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_RETURN_(entry != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(entry->_index != 0U) {
+    Remove(me, entry);
+  }
+
+  if(me->_count >= me->_capacity) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t deadline = fChronoClock_GetTick64(me->_clock) + delayTick;
+  if(me->_inRun && (deadline <= me->_runTick)) {
+    deadline = me->_runTick + 1U;
+  }
+
+  entry->_deadline = deadline;
+  entry->_period = periodTick;
+  entry->_callback = callback;
+  entry->_arg = arg;
+
+  me->_count++;
+  Place(me, me->_count - 1U, entry);
+  SiftUp(me, me->_count - 1U);
+
+  return TRUE;
+}
+
+/**
+ * @brief Removes the entry from the scheduler. Stopping an entry that is not scheduled has no effect.
+ *
+ * @param me Pointer to the scheduler object
+ * @param entry Pointer to the entry object
+ */
+void fChronoSched_Stop(sChronoSched * const me, sChronoSchedEntry * const entry) {
+
+  ASSERT_(me != NULL);    /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_(entry != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(entry->_index != 0U) {
+    Remove(me, entry);
+  }
+}
+
+/**
+ * @brief Returns TRUE if the entry is scheduled.
+ *
+ * @param entry Pointer to the entry object
+ * @retval isScheduled: TRUE if the entry is scheduled
+ */
+bool_t fChronoSched_IsScheduled(sChronoSchedEntry const * const entry) {
+
+  ASSERT_RETURN_(entry != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  return (entry->_index != 0U);
+}
+
+/**
+ * @brief Calls the callbacks of the entries that are due.
+ *
+ * @note A periodic entry is scheduled again at its next deadline after the current tick, before its callback is called.
+ *       A one-shot entry is removed before its callback is called, so the callback can start it again.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval count: Number of callbacks that were called
+ */
+uint32_t fChronoSched_Run(sChronoSched * const me) {
+
+  uint32_t count = 0U;
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  sChronoSchedEntry *entry = fChronoSched_RunNext(me);
+  while(entry != NULL) {
+    if(entry->_callback != NULL) {
+      entry->_callback(entry, entry->_arg);
+    }
+    count++;
+    entry = fChronoSched_RunNext(me);
+  }
+
+  return count;
+}
+
+/**
+ * @brief Takes the next due entry out of the current run, for callers that call the callbacks themselves (e.g., outside a critical section).
+ *
+ * @note The first call starts a run at the current tick. Each call reschedules or removes the entry that it returns, like fChronoSched_Run().
+ *       Call it until it returns NULL, which ends the run. Entries that are started with zero delay during the run are due in the next run.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval entry: The due entry, or NULL if no entry is due
+ */
+sChronoSchedEntry* fChronoSched_RunNext(sChronoSched * const me) {
+
+  ASSERT_RETURN_(me != NULL, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(!me->_inRun) {
+    me->_inRun = TRUE;
+    me->_runTick = fChronoClock_GetTick64(me->_clock);
+  }
+
+  if((me->_count == 0U) || (me->_heap[0]->_deadline > me->_runTick)) {
+    me->_inRun = FALSE;
+    return NULL;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t now = me->_runTick;
+  sChronoSchedEntry *entry = me->_heap[0];
+
+  if(entry->_period != 0U) {
+    entry->_deadline += entry->_period * (((now - entry->_deadline) / entry->_period) + 1U);
+    SiftDown(me, 0U);
+  } else {
+    Remove(me, entry);
+  }
+
+  return entry;
+}
+
+/**
+ * @brief Returns the number of ticks until the next entry is due.
+ *
+ * @note The application can sleep for this many ticks without missing a deadline. Zero means an entry is already due.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval ticks: Ticks until the next deadline, or CHRONO_SCHED_NO_DEADLINE if no entry is scheduled
+ */
+uint64_t fChronoSched_NextDeadlineTicks(sChronoSched const * const me) {
+
+  ASSERT_RETURN_(me != NULL, CHRONO_SCHED_NO_DEADLINE); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(me->_count == 0U) {
+    return CHRONO_SCHED_NO_DEADLINE;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t now = fChronoClock_GetTick64(me->_clock);
+  uint64_t deadline = me->_heap[0]->_deadline;
+
+  return (deadline > now) ? (deadline - now) : 0U;
+}
+
+/**
+ * @brief Returns the number of scheduled entries.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval count: Number of scheduled entries
+ */
+uint32_t fChronoSched_GetCount(sChronoSched const * const me) {
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return me->_count;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Puts the entry at the position of the heap and updates its index.
+ *
+ * @param me Pointer to the scheduler object
+ * @param position Position in the heap
+ * @param entry Pointer to the entry object
+ */
+static void Place(sChronoSched * const me, uint32_t position, sChronoSchedEntry * const entry) {
+
+  me->_heap[position] = entry;
+  entry->_index = position + 1U;
+}
+
+/**
+ * @brief Moves the entry at the position towards the root until its parent is not later than it.
+ *
+ * @param me Pointer to the scheduler object
+ * @param position Position in the heap
+ */
+static void SiftUp(sChronoSched * const me, uint32_t position) {
+
+  sChronoSchedEntry *entry = me->_heap[position];
+
+  while(position > 0U) {
+    uint32_t parent = (position - 1U) / 2U;
+    if(me->_heap[parent]->_deadline <= entry->_deadline) {
+      break;
+    }
+    Place(me, position, me->_heap[parent]);
+    position = parent;
+  }
+
+  Place(me, position, entry);
+}
+
+/**
+ * @brief Moves the entry at the position towards the leaves until its children are not earlier than it.
+ *
+ * @param me Pointer to the scheduler object
+ * @param position Position in the heap
+ */
+static void SiftDown(sChronoSched * const me, uint32_t position) {
+
+  sChronoSchedEntry *entry = me->_heap[position];
+
+  while(TRUE) {
+    uint32_t child = (2U * position) + 1U;
+    if(child >= me->_count) {
+      break;
+    }
+    if(((child + 1U) < me->_count) && (me->_heap[child + 1U]->_deadline < me->_heap[child]->_deadline)) {
+      child++;
+    }
+    if(entry->_deadline <= me->_heap[child]->_deadline) {
+      break;
+    }
+    Place(me, position, me->_heap[child]);
+    position = child;
+  }
+
+  Place(me, position, entry);
+}
+
+/**
+ * @brief Removes the scheduled entry from the heap.
+ *
+ * @param me Pointer to the scheduler object
+ * @param entry Pointer to the entry object
+ */
+static void Remove(sChronoSched * const me, sChronoSchedEntry * const entry) {
+
+  uint32_t position = entry->_index - 1U;
+
+  me->_count--;
+  entry->_index = 0U;
+
+  if(position != me->_count) {
+    Place(me, position, me->_heap[me->_count]);
+    SiftDown(me, position);
+    SiftUp(me, position);
+  }
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
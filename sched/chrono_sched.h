@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_sched.h
+  * @brief          : ChronoSched module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_sched.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_SCHED_H
+#define CHRONO_SCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "..\chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Result values of fChronoSched_Init() in addition to CHRONO_OK.
+ *
+ */
+#define CHRONO_SCHED_ERROR_CLOCK      (20U)
+#define CHRONO_SCHED_ERROR_HEAP       (21U)
+
+/**
+ * @brief Returned by fChronoSched_NextDeadlineTicks() when no entry is scheduled.
+ *
+ */
+#define CHRONO_SCHED_NO_DEADLINE      (UINT64_MAX)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+struct sChronoSchedEntry_;
+
+/**
+  * @brief Pointer to the function that is called when an entry is due.
+  *
+  */
+typedef void(*fpChronoSchedCallback_t)(struct sChronoSchedEntry_ * const entry, void *arg);
+
+/**
+  * @brief Definition of the entry object of the scheduler.
+  *
+  * @note Users create one entry for each periodic or one-shot job. The scheduler keeps a pointer to the entry, so it must stay valid while it is scheduled.
+  *       An entry must be zero-initialized (e.g., static or "= {0}") before it is started for the first time.
+  *
+  */
+typedef struct sChronoSchedEntry_ {
+
+  uint64_t _deadline;                 /*!< 64-bit tick of the clock at which the entry is due. This parameter is private. */
+
+  uint64_t _period;                   /*!< Period of the entry in ticks, or zero for a one-shot entry. This parameter is private. */
+
+  fpChronoSchedCallback_t _callback;  /*!< Function that is called when the entry is due. This parameter is private. */
+
+  void *_arg;                         /*!< Argument of the callback. This parameter is private. */
+
+  uint32_t _index;                    /*!< Position of the entry in the heap plus one, or zero if it is not scheduled. This parameter is private. */
+}sChronoSchedEntry;
+
+/**
+  * @brief Definition of the scheduler object.
+  *
+  * @note The entries are kept in a binary min-heap ordered by their deadline. The user provides the heap array, so the scheduler doesn't allocate memory.
+  *
+  */
+typedef struct {
+
+  sChronoClock const *_clock;         /*!< Clock that drives the scheduler. */
+
+  sChronoSchedEntry **_heap;          /*!< Heap array of the scheduled entries. */
+
+  uint32_t _capacity;                 /*!< Number of elements in the heap array. */
+
+  uint32_t _count;                    /*!< Number of scheduled entries. */
+
+  bool_t _inRun;                      /*!< TRUE while a run of fChronoSched_Run() or fChronoSched_RunNext() is in progress. */
+
+  uint64_t _runTick;                  /*!< The tick that fChronoSched_Run() compares the deadlines with. */
+}sChronoSched;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+chrono_res_t fChronoSched_Init(sChronoSched * const me, sChronoClock const * const clock, sChronoSchedEntry ** const heap, uint32_t capacity);
+bool_t fChronoSched_Start(sChronoSched * const me, sChronoSchedEntry * const entry, uint64_t delayTick, uint64_t periodTick, fpChronoSchedCallback_t callback, void *arg);
+void fChronoSched_Stop(sChronoSched * const me, sChronoSchedEntry * const entry);
+bool_t fChronoSched_IsScheduled(sChronoSchedEntry const * const entry);
+uint32_t fChronoSched_Run(sChronoSched * const me);
+sChronoSchedEntry* fChronoSched_RunNext(sChronoSched * const me);
+uint64_t fChronoSched_NextDeadlineTicks(sChronoSched const * const me);
+uint32_t fChronoSched_GetCount(sChronoSched const * const me);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_SCHED_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -36,9 +36,26 @@ extern "C" {
   *
   * @note If reading tick value from the an address in memory is not possible, and a function will return current tick value,
   *       set CHRONO_TICK_TYPE to TICK_TYPE_FUNCTION. In this case, chrono module will call this function whenever it needs to get the tick.
+  *
+  * @note On a Linux host, set CHRONO_TICK_TYPE to TICK_TYPE_HOST and select one of the built-in counters with CHRONO_TICK_HOST_SOURCE.
+  *       The counter is read inline and fChrono_Init() has no parameter.
   */
  #define CHRONO_TICK_TYPE  TICK_TYPE_VARIABLE
 
+/**
+  * @brief Select the host counter when CHRONO_TICK_TYPE is TICK_TYPE_HOST.
+  *
+  * @note TICK_HOST_MONOTONIC_RAW and TICK_HOST_MONOTONIC_COARSE count nanoseconds, so CHRONO_TICK_TO_NANOSECOND_COEF must be 1.
+  *       They need the Linux declarations of time.h, e.g., compile with -D_GNU_SOURCE.
+  *
+  * @note TICK_HOST_RDTSC and TICK_HOST_RDTSCP (x86) and TICK_HOST_CNTVCT (arm64) count at the frequency of the counter, which must be
+  *       set with CHRONO_TICK_PERIOD_NUM and CHRONO_TICK_PERIOD_DEN. RDTSCP is ordered after the previous instructions, RDTSC is not.
+  *       Alternatively, call fChrono_InitCalibrated() to measure the frequency at init. The period in this file is then only an initial estimate.
+  *
+  * @note The host counters are 64-bit. With a 32-bit tick_t, set CHRONO_TICK_TOP_VALUE to 0xFFFFFFFFU and the lower bits are used.
+  */
+//#define CHRONO_TICK_HOST_SOURCE  TICK_HOST_MONOTONIC_RAW
+
 
 /**
  * @brief Set the top value that the tick generator can count.
@@ -56,6 +73,16 @@ extern "C" {
  */
 #define CHRONO_TICK_TO_NANOSECOND_COEF  (100U)
 
+/**
+ * @brief Set the tick period in nanoseconds as a ratio, when it is not an integer number of nanoseconds.
+ * 
+ * @note For example, a 24 MHz counter has a period of 125/3 ns and a 168 MHz counter has a period of 125/21 ns.
+ *       When these values are defined, they are used instead of CHRONO_TICK_TO_NANOSECOND_COEF for all conversions.
+ * 
+ */
+//#define CHRONO_TICK_PERIOD_NUM  (125U)
+//#define CHRONO_TICK_PERIOD_DEN  (21U)
+
 /**
   * @brief Select the counter mode of the tick generator.
   *
@@ -71,6 +98,60 @@ extern "C" {
  */
 #define CHRONO_USE_FULL_ASSERT
 
+/**
+ * @brief Uncomment to define the hot functions of the objective API as static inline functions in the header.
+ * 
+ * @note fChrono_GetTick(), fChrono_Start(), fChrono_ElapsedS/Ms/Us/Ns/Tick(), fChrono_IsTimeout() and fChrono_IntervalS/Ms/Us/Ns/Tick() are affected.
+ *       Each call compiles to a tick read and a compare, which is useful in tight polling loops. Code size grows with the number of call sites.
+ * 
+ */
+//#define CHRONO_INLINE
+
+/**
+ * @brief Uncomment to let sChrono objects measure time spans longer than one period of the tick generator.
+ * 
+ * @note The chrono objects tag the 64-bit tick of the clock (see fChrono_GetTick64()) instead of the raw tick, so the size of sChrono grows
+ *       and each access costs a few more instructions. The tick must still be observed at least once per period of the tick generator,
+ *       either by the regular use of the module or by calling fChrono_UpdateTimebase() in the overflow interrupt of the timer.
+ * 
+ */
+//#define CHRONO_TICK_EXTENSION
+
+/**
+ * @brief Uncomment to let the delay functions sleep for the bulk of a delay and spin only for its last part.
+ * 
+ * @note With TICK_TYPE_HOST the delays sleep with clock_nanosleep(). On an MCU, set a sleep function with fChrono_SetDelaySleep(),
+ *       e.g., one that executes __WFI(), so the core stays in low-power mode during the delay.
+ *       The spin window starts at CHRONO_DELAY_SPIN_NS and follows the measured wake-up latency up to CHRONO_DELAY_SPIN_MAX_NS.
+ * 
+ */
+//#define CHRONO_DELAY_SLEEP
+//#define CHRONO_DELAY_SPIN_NS      (50000U)
+//#define CHRONO_DELAY_SPIN_MAX_NS  (1000000U)
+
+/**
+ * @brief Uncomment to measure the fixed cost of the delay and elapsed functions at init and subtract it automatically.
+ * 
+ * @note The cost of the call, the assertions, the time conversion and the tick reads makes fChrono_DelayUs(1) overshoot and adds a bias
+ *       to short measurements with fChrono_Start() and fChrono_ElapsedXX(). fChrono_GetDelayOverheadTick() and fChrono_GetElapsedOverheadTick()
+ *       return the measured values. The init functions take a few more tick reads.
+ * 
+ */
+//#define CHRONO_OVERHEAD_COMPENSATION
+
+/**
+ * @brief Uncomment to execute a spin hint between two tick reads of the busy-wait loops, i.e., the delays and WAIT_FOR_WITH_TIMEOUT_XX_().
+ * 
+ * @note CHRONO_CPU_RELAX_() is "pause" on x86 and "yield" on arm, so a sibling hyperthread gets the shared core while the loop waits.
+ *       On an MCU, __WFE() can be used if an event wakes the core up in time, e.g., an interrupt with SEVONPEND set. Otherwise the loop stalls.
+ * 
+ * @note The number of hints between two reads doubles after each read up to CHRONO_SPIN_BACKOFF_MAX (a power of two, default 1).
+ *       A larger value reads the timer register less often, but a delay can end up to CHRONO_SPIN_BACKOFF_MAX hints late.
+ * 
+ */
+//#define CHRONO_SPIN_HINT()        CHRONO_CPU_RELAX_()
+//#define CHRONO_SPIN_BACKOFF_MAX   (8U)
+
 /**
  * @brief User typedefs for measurements in chrono module.
  * 
@@ -37,6 +37,12 @@ extern "C" {
 #define TEST_GROUP_8  (8U)
 #define TEST_GROUP_9  (9U)
 #define TEST_GROUP_10 (10U)
+#define TEST_GROUP_11 (11U)
+#define TEST_GROUP_12 (12U)
+#define TEST_GROUP_13 (13U)
+#define TEST_GROUP_14 (14U)
+#define TEST_GROUP_15 (15U)
+#define TEST_GROUP_16 (16U)
 
 #define CHRONO_TESTS_DISABLED (0U)
 #define CHRONO_TESTS_ENABLED  (1U)
@@ -192,6 +198,163 @@ typedef uint32_t timeUs_t;
 /** @} */ //End of TEST_GROUP_8_CONFIG
 #endif
 
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+/** @defgroup TEST_GROUP_9_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (7U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_9_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+/** @defgroup TEST_GROUP_10_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_PERIOD_NUM          (125U)
+#define CHRONO_TICK_PERIOD_DEN          (21U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_10_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+/** @defgroup TEST_GROUP_11_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_TICK_EXTENSION
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_11_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+/** @defgroup TEST_GROUP_12_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (15U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef float timeS_t;
+typedef double timeMs_t;
+typedef float timeUs_t;
+
+/** @} */ //End of TEST_GROUP_12_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+/** @defgroup TEST_GROUP_13_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_HOST
+#define CHRONO_TICK_HOST_SOURCE         TICK_HOST_MONOTONIC_RAW
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_DELAY_SLEEP
+#define CHRONO_OVERHEAD_COMPENSATION
+#define CHRONO_SPIN_HINT()              CHRONO_CPU_RELAX_()
+#define CHRONO_SPIN_BACKOFF_MAX         (8U)
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_13_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+/** @defgroup TEST_GROUP_14_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_DELAY_SLEEP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_14_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+/** @defgroup TEST_GROUP_15_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_OVERHEAD_COMPENSATION
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_15_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_16)
+/** @defgroup TEST_GROUP_16_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_SPIN_HINT()              ChronoTest_SpinHint()
+#define CHRONO_SPIN_BACKOFF_MAX         (8U)
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+void ChronoTest_SpinHint(void);
+
+/** @} */ //End of TEST_GROUP_16_CONFIG
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,704 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_cpp_test.cpp
+  * @brief          : Unit tests of the C++ layers of the chrono module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <cstdlib>
+#include <new>
+#include <chrono>
+
+#include "chrono_test.h"
+#include "chrono_config.h"
+
+#include "..\chrono.h"
+#include "..\coro\chrono_coro.hpp"
+
+/* chrono_clock.hpp needs a non-zero tick period, so it and its tests are left out of the other configurations. */
+#if (defined(CHRONO_TICK_PERIOD_NUM) && (CHRONO_TICK_PERIOD_NUM != 0)) || (defined(CHRONO_TICK_TO_NANOSECOND_COEF) && (CHRONO_TICK_TO_NANOSECOND_COEF != 0))
+#define CHRONO_TEST_CLOCK_HPP_
+#include "..\clock\chrono_clock.hpp"
+#endif
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+#include <time.h>
+#endif
+
+#include "unity_fixture.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
+static volatile uint32_t tickVal;
+static volatile tick_t *pTick;
+#endif
+
+/**
+ * @brief Number of blocks that are allocated with operator new and not freed yet, i.e., the coroutine frames that are alive.
+ *
+ */
+static uint32_t liveAllocations;
+
+/* Private function prototypes -----------------------------------------------*/
+static void RunTests(void);
+static void OneTimeSetup(void);
+static void OneTimeTearDown(void);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Function that runs the unit tests of the C++ layers and returns the result.
+ *
+ * @return int
+ */
+int fChrono_CppUnitTests_Run(int argc, const char* argv[]) {
+
+  int ret = 0;
+
+  OneTimeSetup();
+
+#if (CHRONO_TEST_STATUS == CHRONO_TESTS_ENABLED)
+  ret = UnityMain(argc, argv, RunTests);
+#endif
+
+  OneTimeTearDown();
+
+  return ret;
+}
+
+/**
+ * @brief Allocation functions that count the live blocks, so the tests can check that the coroutine frames are freed.
+ *
+ */
+void* operator new(std::size_t size) {
+
+  void *block = std::malloc((size == 0U) ? 1U : size);
+  if(block == nullptr) {
+    throw std::bad_alloc();
+  }
+  liveAllocations++;
+
+  return block;
+}
+
+void operator delete(void *block) noexcept {
+
+  if(block != nullptr) {
+    liveAllocations--;
+    std::free(block);
+  }
+}
+
+void operator delete(void *block, std::size_t size) noexcept {
+
+  (void)size;
+  operator delete(block);
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                              ##### Unit Tests #####                              ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_1) || (CHRONO_TEST_GROUP == TEST_GROUP_12))
+/**
+ * @brief Task that counts its steps around one sleep_for().
+ *
+ */
+static chrono::task SleepUs(timeUs_t us, uint32_t *step) {
+
+  (*step)++;
+  co_await chrono::sleep_for(us);
+  (*step)++;
+}
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
+/** @defgroup TEST_GROUP_1_CORO
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ *
+ */
+TEST_GROUP(CORO_1);
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(CORO_1) {
+
+  tickVal = 0;
+  fChrono_Init(&tickVal);
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(CORO_1) {
+
+}
+
+/**
+ * @brief Task that counts its steps around one sleep_for_ticks().
+ *
+ */
+static chrono::task SleepTicks(uint64_t ticks, uint32_t *step) {
+
+  (*step)++;
+  co_await chrono::sleep_for_ticks(ticks);
+  (*step)++;
+}
+
+/**
+ * @brief Task that waits for a flag with a timeout and records the result of the wait.
+ *
+ */
+static chrono::task WaitFlag(bool const *flag, timeUs_t timeoutUs, int *result) {
+
+  *result = co_await chrono::wait_until([flag] { return *flag; }, timeoutUs);
+}
+
+/**
+ * @brief sleep_for() resumes the task on the first step boundary after its time. The frame of the task is freed when it returns.
+ *
+ */
+TEST(CORO_1, ChronoCoro_SleepForIsAwaited_ResumesAfterTimeAndFreesFrame) {
+
+  chrono::executor exec;
+  uint32_t step = 0;
+  uint32_t allocations = liveAllocations;
+
+  /* One tick is 1 us and one step of the wheel is 10 ticks. */
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(fChrono_GetDefaultClock(), 10U));
+
+  exec.spawn(SleepUs(100U, &step));
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.count());
+  TEST_ASSERT_EQUAL_UINT32(allocations + 1U, liveAllocations);
+
+  tickVal = 99U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+
+  tickVal = 110U;
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(2U, step);
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.count());
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+
+  /* A sleep of zero doesn't suspend the task. */
+  step = 0;
+  exec.spawn(SleepUs(0U, &step));
+  TEST_ASSERT_EQUAL_UINT32(2U, step);
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.count());
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+}
+
+/**
+ * @brief Tick of the 1 ns clock of the long sleep test. The clock returns its low 32 bits.
+ *
+ */
+static uint64_t nsClockTick;
+
+/**
+ * @brief Returns the tick value of the 1 ns clock of the long sleep test.
+ *
+ */
+static tick_t GetNsClockTick(void) {
+
+  return (tick_t)(nsClockTick & 0xFFFFFFFFU);
+}
+
+/**
+ * @brief sleep_for() waits for the whole time, also when it is longer than the tick range of the clock of the executor.
+ *
+ */
+TEST(CORO_1, ChronoCoro_SleepForIsLongerThanTickRange_ResumesAfterWholeTime) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = {
+    .TickValue = NULL,
+    .GetTickValue = GetNsClockTick,
+    .TickTopValue = 0xFFFFFFFFU,
+    .TickPeriodNum = 1U,
+    .TickPeriodDen = 1U,
+    .CounterMode = TICK_COUNTERMODE_UP
+  };
+  chrono::executor exec;
+  uint32_t step = 0;
+
+  nsClockTick = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(&clock, 1000000U));
+
+  /* 5 s are 5e9 ticks of 1 ns. Truncated to the 32-bit tick they would be about 0.7 s. */
+  TEST_ASSERT_EQUAL_UINT64(5000000000U, exec.us_to_ticks(5000000U));
+
+  exec.spawn(SleepUs(5000000U, &step));
+  while((step < 2U) && (nsClockTick < 10000000000U)) {
+    nsClockTick += 100000000U;
+    (void)exec.run_once();
+  }
+
+  /* The elapsed ticks of a wrap around are counted up to the top value, so the task resumes on the step after 5 s. */
+  TEST_ASSERT_EQUAL_UINT32(2U, step);
+  TEST_ASSERT_EQUAL_UINT64(5100000000U, nsClockTick);
+}
+
+/**
+ * @brief sleep_for_ticks() waits for ticks of the clock of the executor.
+ *
+ */
+TEST(CORO_1, ChronoCoro_SleepForTicksIsAwaited_ResumesAfterTicks) {
+
+  chrono::executor exec;
+  uint32_t step = 0;
+  uint32_t allocations = liveAllocations;
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(fChrono_GetDefaultClock(), 10U));
+
+  exec.spawn(SleepTicks(50U, &step));
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+
+  tickVal = 49U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+
+  tickVal = 60U;
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(2U, step);
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+}
+
+/**
+ * @brief wait_until() resumes the task with true when the condition becomes true before the timeout.
+ *
+ */
+TEST(CORO_1, ChronoCoro_WaitUntilConditionBecomesTrue_ReturnsTrue) {
+
+  chrono::executor exec;
+  bool flag = false;
+  int result = -1;
+  uint32_t allocations = liveAllocations;
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(fChrono_GetDefaultClock(), 10U));
+
+  exec.spawn(WaitFlag(&flag, 1000U, &result));
+  TEST_ASSERT_EQUAL(-1, result);
+
+  tickVal = 500U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+  TEST_ASSERT_EQUAL(-1, result);
+
+  flag = true;
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.run_once());
+  TEST_ASSERT_EQUAL(1, result);
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.count());
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+
+  /* The timer of the wait is cancelled, so nothing expires later. */
+  tickVal = 2000U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+
+  /* A condition that is already true doesn't suspend the task. */
+  result = -1;
+  exec.spawn(WaitFlag(&flag, 1000U, &result));
+  TEST_ASSERT_EQUAL(1, result);
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+}
+
+/**
+ * @brief wait_until() resumes the task with false when the timeout expires before the condition becomes true.
+ *
+ */
+TEST(CORO_1, ChronoCoro_WaitUntilTimesOut_ReturnsFalse) {
+
+  chrono::executor exec;
+  bool flag = false;
+  int result = -1;
+  uint32_t allocations = liveAllocations;
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(fChrono_GetDefaultClock(), 10U));
+
+  exec.spawn(WaitFlag(&flag, 1000U, &result));
+
+  tickVal = 999U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+  TEST_ASSERT_EQUAL(-1, result);
+
+  tickVal = 1010U;
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.run_once());
+  TEST_ASSERT_EQUAL(0, result);
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.count());
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+
+  /* The waiter left the polling list, so a later condition doesn't resume anything. */
+  flag = true;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+}
+
+/**
+ * @brief A task that is never spawned is destroyed with the task object and its frame is freed.
+ *
+ */
+TEST(CORO_1, ChronoCoro_TaskIsNotSpawned_FrameIsFreedWithTask) {
+
+  uint32_t step = 0;
+  uint32_t allocations = liveAllocations;
+
+  {
+    chrono::task idle = SleepUs(100U, &step);
+    TEST_ASSERT_EQUAL_UINT32(allocations + 1U, liveAllocations);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(0U, step);
+  TEST_ASSERT_EQUAL_UINT32(allocations, liveAllocations);
+}
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(CORO_1) {
+
+  RUN_TEST_CASE(CORO_1, ChronoCoro_SleepForIsAwaited_ResumesAfterTimeAndFreesFrame);
+  RUN_TEST_CASE(CORO_1, ChronoCoro_SleepForIsLongerThanTickRange_ResumesAfterWholeTime);
+  RUN_TEST_CASE(CORO_1, ChronoCoro_SleepForTicksIsAwaited_ResumesAfterTicks);
+  RUN_TEST_CASE(CORO_1, ChronoCoro_WaitUntilConditionBecomesTrue_ReturnsTrue);
+  RUN_TEST_CASE(CORO_1, ChronoCoro_WaitUntilTimesOut_ReturnsFalse);
+  RUN_TEST_CASE(CORO_1, ChronoCoro_TaskIsNotSpawned_FrameIsFreedWithTask);
+}
+
+/** @} */ //End of TEST_GROUP_1_CORO
+#endif
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_1) && defined(CHRONO_TEST_CLOCK_HPP_))
+/** @defgroup TEST_GROUP_1_CLOCK
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ *
+ */
+TEST_GROUP(CLOCK_1);
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(CLOCK_1) {
+
+  tickVal = 0;
+  fChrono_Init(&tickVal);
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(CLOCK_1) {
+
+}
+
+/**
+ * @brief The period of chrono_clock is the tick period of chrono_config.h and now() returns the 64-bit tick.
+ *
+ */
+TEST(CLOCK_1, ChronoClock_NowIsCalled_ReturnsTickAsMicroseconds) {
+
+  TEST_ASSERT_TRUE((std::ratio_equal<chrono::chrono_clock::period, std::micro>::value));
+
+  tickVal = 1234U;
+  TEST_ASSERT_EQUAL(1234, chrono::chrono_clock::now().time_since_epoch().count());
+  TEST_ASSERT_EQUAL(1234, std::chrono::duration_cast<std::chrono::microseconds>(chrono::chrono_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief to_ticks() rounds up and gives zero for negative durations.
+ *
+ */
+TEST(CLOCK_1, ChronoClock_DurationsAreConverted_RoundedUpToTicks) {
+
+  TEST_ASSERT_EQUAL_UINT64(250000U, chrono::to_ticks(std::chrono::milliseconds(250)));
+  TEST_ASSERT_EQUAL_UINT64(2U, chrono::to_ticks(std::chrono::nanoseconds(1500)));
+  TEST_ASSERT_EQUAL_UINT64(1U, chrono::to_ticks(std::chrono::nanoseconds(1)));
+  TEST_ASSERT_EQUAL_UINT64(0U, chrono::to_ticks(std::chrono::milliseconds(-1)));
+  TEST_ASSERT_EQUAL_UINT64(7200000000U, chrono::to_ticks(std::chrono::hours(2)));
+}
+
+/**
+ * @brief start_timeout(), elapsed() and left() work like the C functions with std::chrono durations.
+ *
+ */
+TEST(CLOCK_1, ChronoClock_TimeoutIsStarted_ElapsedAndLeftFollowTick) {
+
+  sChrono timeout;
+
+  tickVal = 1000U;
+  TEST_ASSERT_TRUE(chrono::start_timeout(timeout, std::chrono::milliseconds(2)));
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&timeout));
+
+  tickVal = 1500U;
+  TEST_ASSERT_EQUAL(500, chrono::elapsed(timeout).count());
+  TEST_ASSERT_EQUAL(1500, chrono::left(timeout).count());
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&timeout));
+
+  tickVal = 3000U;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&timeout));
+  TEST_ASSERT_EQUAL(0, chrono::left(timeout).count());
+
+  TEST_ASSERT_EQUAL_UINT32(10U, chrono::span(5U, 15U).count());
+}
+
+/**
+ * @brief A timeout longer than the tick range is rejected instead of being truncated to a short one.
+ *
+ */
+TEST(CLOCK_1, ChronoClock_TimeoutIsLongerThanTickRange_IsRejected) {
+
+  sChrono timeout;
+
+  TEST_ASSERT_EQUAL_UINT64(0xFFFFFFFFU, chrono::max_timeout_ticks());
+
+  tickVal = 1000U;
+  TEST_ASSERT_TRUE(chrono::start_timeout(timeout, std::chrono::microseconds(0xFFFFFFFFU)));
+  TEST_ASSERT_EQUAL(0xFFFFFFFFLL, chrono::left(timeout).count());
+
+  /* 2 hours are 7.2e9 ticks of 1 us. Truncated to 32 bits they would be about 2.9e9 ticks. */
+  TEST_ASSERT_FALSE(chrono::start_timeout(timeout, std::chrono::hours(2)));
+  TEST_ASSERT_FALSE(chrono::start_timeout(timeout, std::chrono::microseconds(0x100000000LL)));
+  TEST_ASSERT_EQUAL(0xFFFFFFFFLL, chrono::left(timeout).count());
+}
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(CLOCK_1) {
+
+  RUN_TEST_CASE(CLOCK_1, ChronoClock_NowIsCalled_ReturnsTickAsMicroseconds);
+  RUN_TEST_CASE(CLOCK_1, ChronoClock_DurationsAreConverted_RoundedUpToTicks);
+  RUN_TEST_CASE(CLOCK_1, ChronoClock_TimeoutIsStarted_ElapsedAndLeftFollowTick);
+  RUN_TEST_CASE(CLOCK_1, ChronoClock_TimeoutIsLongerThanTickRange_IsRejected);
+}
+
+/** @} */ //End of TEST_GROUP_1_CLOCK
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+/** @defgroup TEST_GROUP_12_CORO
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ *
+ */
+TEST_GROUP(CORO_12);
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(CORO_12) {
+
+  tickVal = 0;
+  fChrono_Init(&tickVal);
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(CORO_12) {
+
+}
+
+/**
+ * @brief sleep_for() keeps the fraction of a floating point microsecond and converts it like fChrono_StartTimeoutUs().
+ *
+ */
+TEST(CORO_12, ChronoCoro_SleepForFractionalUs_WaitsSameTicksAsTimeout) {
+
+  chrono::executor exec;
+  uint32_t step = 0;
+
+  /* One tick is 15 ns, so 1.5 us is 100 ticks. The step of the wheel is 1 tick. */
+  TEST_ASSERT_EQUAL(CHRONO_OK, exec.init(fChrono_GetDefaultClock(), 1U));
+  TEST_ASSERT_EQUAL_UINT64(100U, exec.us_to_ticks(1.5f));
+
+  exec.spawn(SleepUs(1.5f, &step));
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+
+  tickVal = 99U;
+  TEST_ASSERT_EQUAL_UINT32(0U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(1U, step);
+
+  tickVal = 100U;
+  TEST_ASSERT_EQUAL_UINT32(1U, exec.run_once());
+  TEST_ASSERT_EQUAL_UINT32(2U, step);
+}
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(CORO_12) {
+
+  RUN_TEST_CASE(CORO_12, ChronoCoro_SleepForFractionalUs_WaitsSameTicksAsTimeout);
+}
+
+/** @} */ //End of TEST_GROUP_12_CORO
+#endif
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_13) && defined(CHRONO_TEST_CLOCK_HPP_))
+/** @defgroup TEST_GROUP_13_CLOCK
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ *
+ */
+TEST_GROUP(CLOCK_13);
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(CLOCK_13) {
+
+  fChrono_Init();
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(CLOCK_13) {
+
+}
+
+/**
+ * @brief Returns the time of CLOCK_MONOTONIC in nanoseconds.
+ *
+ */
+static uint64_t MonotonicNs(void) {
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief delay() waits for the whole duration, also when it is longer than the 32-bit range of a 1 ns tick (about 4.29 s).
+ *
+ */
+TEST(CLOCK_13, ChronoClock_DelayIsLongerThanTickRange_WaitsWholeDuration) {
+
+  uint64_t start = MonotonicNs();
+  chrono::delay(std::chrono::milliseconds(2));
+  uint64_t span = MonotonicNs() - start;
+  TEST_ASSERT_GREATER_OR_EQUAL(2000000, span);
+
+  /* Truncated to 32 bits, 4.5 s of 1 ns ticks would be about 205 ms. */
+  start = MonotonicNs();
+  chrono::delay(std::chrono::milliseconds(4500));
+  span = MonotonicNs() - start;
+  TEST_ASSERT_GREATER_OR_EQUAL(4500000000LL, span);
+  TEST_ASSERT_LESS_OR_EQUAL(5000000000LL, span);
+}
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(CLOCK_13) {
+
+  RUN_TEST_CASE(CLOCK_13, ChronoClock_DelayIsLongerThanTickRange_WaitsWholeDuration);
+}
+
+/** @} */ //End of TEST_GROUP_13_CLOCK
+#endif
+
+/**
+ * @brief Runs the test groups of the C++ layers that match the selected configuration.
+ *
+ */
+static void RunTests(void) {
+
+#if(CHRONO_TEST_STATUS == CHRONO_TESTS_DISABLED)
+  (void)(RunTests);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
+  RUN_TEST_GROUP(CORO_1);
+#endif
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_1) && defined(CHRONO_TEST_CLOCK_HPP_))
+  RUN_TEST_GROUP(CLOCK_1);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+  RUN_TEST_GROUP(CORO_12);
+#endif
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_13) && defined(CHRONO_TEST_CLOCK_HPP_))
+  RUN_TEST_GROUP(CLOCK_13);
+#endif
+}
+
+/**
+ * @brief Unit test one time setup.
+ *
+ */
+static void OneTimeSetup(void) {
+
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
+  pTick = fChrono_GetTickPointer();
+#endif
+}
+
+/**
+ * @brief Unit test one time teardown.
+ *
+ */
+static void OneTimeTearDown(void) {
+
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
+  fChrono_Init(pTick);
+#else
+  fChrono_Init();
+#endif
+}
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -22,23 +22,37 @@
 #include "chrono_config.h"
 
 #include "..\chrono.h"
+#include "..\chrono_ex.h"
 #include "..\long\chrono_long.h"
+#include "..\wheel\chrono_wheel.h"
+#include "..\sched\chrono_sched.h"
+#include "..\exec\chrono_exec.h"
+#include "..\timer\chrono_timer.h"
 
 #include "unity_fixture.h"
 
+#if (CHRONO_TICK_TYPE == TICK_TYPE_HOST)
+#include <time.h>
+#endif
+
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 #define ArraySize_(arr_)  (sizeof(arr_) / sizeof(arr_[0]))
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
 static volatile uint32_t tickVal;
 static volatile tick_t *pTick;
+#endif
 
 /* Private function prototypes -----------------------------------------------*/
 static void RunTests(void);
 static void OneTimeSetup(void);
 static void OneTimeTearDown(void);
+#if((CHRONO_TEST_GROUP == TEST_GROUP_1) || (CHRONO_TEST_GROUP == TEST_GROUP_13) || (CHRONO_TEST_GROUP == TEST_GROUP_15) || (CHRONO_TEST_GROUP == TEST_GROUP_16))
+static sChronoClockConfig TestClockConfig(fpTick_t getTick, tick_t top, uint32_t periodNum, uint32_t periodDen, uint8_t counterMode);
+#endif
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -188,13 +202,14 @@ TEST(GROUP_1, Chrono_GetTickMsIsCalled_ReturnCumulativeTime) {
   contTick = fChrono_GetContinuousTickMs();
   TEST_ASSERT_EQUAL_UINT64(0x418937, contTick);
 
+  // The fractions of millisecond are not lost between the calls, so the 295us before the overflow count.
   tickVal = 1000;
   contTick = fChrono_GetContinuousTickMs();
-  TEST_ASSERT_EQUAL_UINT64(0x418937, contTick);
+  TEST_ASSERT_EQUAL_UINT64(0x418938, contTick);
 
   tickVal = 0xFFFFFFFF;
   contTick = fChrono_GetContinuousTickMs();
-  TEST_ASSERT_EQUAL_UINT64(0x83126D, contTick);
+  TEST_ASSERT_EQUAL_UINT64(0x83126E, contTick);
 
 }
 
@@ -613,6 +628,1130 @@ TEST(GROUP_1, Chrono_IntervalUsIsCalledWhenChronoIsInit_ReturnInterval) {
 
 }
 
+/**
+ * @brief An instrumented RUN_EVERY block must record the period, the start jitter and the deadline misses of its activations.
+ * 
+ */
+TEST(GROUP_1, ChronoEx_RunEveryStatsBlockIsDelayed_RecordsPeriodJitterAndMisses) {
+
+  sChrono blockChrono = {FALSE, 0, 0, 0, FALSE};
+  sChronoRunStats stats = {0};
+  uint32_t runs = 0;
+  uint32_t const ticks[] = {0, 100, 100, 101, 205, 340, 700};
+  uint32_t const jitter[CHRONO_RUN_STATS_BINS] = {1, 0, 0, 1, 0, 0, 1, 1};
+
+  fChrono_Init(&tickVal);
+
+  for(uint32_t i = 0; i < ArraySize_(ticks); i++) {
+    tickVal = ticks[i];
+    RUN_EVERY_STATS_US_OBJ_(block, &blockChrono, 100, &stats)
+    {
+      runs++;
+      RUN_END_;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(4, runs);
+  TEST_ASSERT_EQUAL_UINT32(4, stats.Count);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.Misses);
+  TEST_ASSERT_EQUAL_UINT32(100, stats.PeriodMin);
+  TEST_ASSERT_EQUAL_UINT32(360, stats.PeriodMax);
+  TEST_ASSERT_EQUAL_UINT32(175, fChrono_RunStatsMeanPeriod(&stats));
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(jitter, stats.Jitter, CHRONO_RUN_STATS_BINS);
+
+  /* The forced first activation has no period, so only the second one is recorded. */
+  fChrono_RunStatsReset(&stats);
+  fChrono_Stop(&blockChrono);
+  for(uint32_t tick = 1000; tick <= 1100U; tick += 100U) {
+    tickVal = tick;
+    RUN_EVERY_STATS_US_OBJ_FORCE_(forced, &blockChrono, 100, &stats)
+    {
+      runs++;
+      RUN_END_;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(6, runs);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.Count);
+  TEST_ASSERT_EQUAL_UINT32(100, fChrono_RunStatsMeanPeriod(&stats));
+  TEST_ASSERT_EQUAL_UINT32(1, stats.Jitter[0]);
+}
+
+/**
+ * @brief Steps of the stackless task in GROUP_1 tests.
+ * 
+ */
+static uint32_t taskStep;
+
+/**
+ * @brief Event that the stackless task waits for in GROUP_1 tests.
+ * 
+ */
+static bool_t taskEvent;
+
+/**
+ * @brief Stackless task that waits for a delay, then for an event with a timeout, and then yields once.
+ * 
+ */
+static uint8_t AwaitTask(sChronoTask * const task) {
+
+  CHRONO_TASK_BEGIN_(task);
+
+  taskStep = 1;
+  CHRONO_AWAIT_US_(task, 100);
+  taskStep = 2;
+  CHRONO_AWAIT_UNTIL_US_(task, taskEvent, 50);
+  taskStep = CHRONO_TASK_IS_TIMEOUT_(task) ? 3U : 4U;
+  CHRONO_TASK_YIELD_(task);
+  taskStep = 5;
+
+  CHRONO_TASK_END_(task);
+}
+
+/**
+ * @brief A stackless task must resume from its last wait in each call, and CHRONO_AWAIT_UNTIL must end with the condition or the timeout.
+ * 
+ */
+TEST(GROUP_1, ChronoEx_TaskAwaitsDelayAndCondition_ResumesFromLastWait) {
+
+  sChronoTask task = {0};
+
+  fChrono_Init(&tickVal);
+  taskEvent = FALSE;
+
+  tickVal = 0;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(1, taskStep);
+  tickVal = 99;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(1, taskStep);
+  tickVal = 100;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(2, taskStep);
+  tickVal = 149;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(2, taskStep);
+  tickVal = 150;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(3, taskStep);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_ENDED, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(5, taskStep);
+
+  /* The task starts again after it ends, and this time the event comes before the timeout. */
+  tickVal = 1000;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(1, taskStep);
+  tickVal = 1100;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(2, taskStep);
+  tickVal = 1120;
+  taskEvent = TRUE;
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(4, taskStep);
+
+  CHRONO_TASK_RESET_(&task);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_TASK_WAITING, AwaitTask(&task));
+  TEST_ASSERT_EQUAL_UINT32(1, taskStep);
+}
+
+/**
+ * @brief Tick value of the user clock in GROUP_1 tests.
+ * 
+ */
+static volatile uint32_t clockTickVal;
+
+/**
+ * @brief Returns the tick value of the user clock in GROUP_1 tests.
+ * 
+ */
+static tick_t GetClockTick(void) {
+  return clockTickVal;
+}
+
+/**
+ * @brief fChronoClock_Init() must reject invalid configurations.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_InitWithInvalidConfig_InitReturnError) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(NULL, 0xFFFFU, 1000000U, 1U, TICK_COUNTERMODE_DOWN);
+
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_TICK_PTR_ERROR, fChronoClock_Init(&clock, NULL));
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_TICK_PTR_ERROR, fChronoClock_Init(&clock, &config));
+
+  config.GetTickValue = GetClockTick;
+  config.CounterMode = 2U;
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_COUNTERMODE, fChronoClock_Init(&clock, &config));
+
+  config.CounterMode = TICK_COUNTERMODE_DOWN;
+  config.TickPeriodDen = 0U;
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_TICK_TO_NS_ZERO, fChronoClock_Init(&clock, &config));
+
+  config.TickPeriodDen = 1U;
+  config.TickTopValue = 0U;
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_TICK_TOP_ZERO, fChronoClock_Init(&clock, &config));
+
+  TEST_ASSERT_EQUAL_UINT32(0, fChronoClock_GetTick(&clock));
+}
+
+/**
+ * @brief A user clock with a different tick source, width, direction and period works side by side with the default clock.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_TwoClocksAreUsedTogether_EachClockUsesItsOwnTick) {
+
+  sChronoClock msClock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000000U, 1U, TICK_COUNTERMODE_DOWN);
+
+  tickVal = 0;
+  clockTickVal = 100;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChrono_Init(&tickVal));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&msClock, &config));
+
+  sChrono usChrono;
+  sChrono msChrono;
+  fChrono_Start(&usChrono);
+  fChronoClock_StartTimeoutMs(&msClock, &msChrono, 150);
+
+  tickVal = 2500;
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL_UINT32(2500, fChrono_ElapsedUs(&usChrono));
+  TEST_ASSERT_EQUAL_UINT32(100, fChronoClock_ElapsedMs(&msClock, &msChrono));
+  TEST_ASSERT_EQUAL_UINT32(50, fChronoClock_LeftMs(&msClock, &msChrono));
+  TEST_ASSERT_EQUAL(false, fChronoClock_IsTimeout(&msClock, &msChrono));
+
+  clockTickVal = 0xFFFFU - 50U;
+  TEST_ASSERT_EQUAL_UINT32(150, fChronoClock_ElapsedMs(&msClock, &msChrono));
+  TEST_ASSERT_EQUAL(true, fChronoClock_IsTimeout(&msClock, &msChrono));
+  TEST_ASSERT_EQUAL_UINT32(2500, fChrono_ElapsedUs(&usChrono));
+
+  TEST_ASSERT_EQUAL_UINT32(65, fChronoClock_GetMaxMeasurableTimeS(&msClock));
+  TEST_ASSERT_EQUAL_UINT32(10, fChronoClock_TimeSpanMs(&msClock, 20, 10));
+  TEST_ASSERT_EQUAL_UINT32(10000, fChronoClock_TimeSpanUs(fChrono_GetDefaultClock(), 10, 10010));
+  TEST_ASSERT_EQUAL_UINT32(2500, fChronoClock_ElapsedUs(fChrono_GetDefaultClock(), &usChrono));
+}
+
+/**
+ * @brief Tick functions of a user clock return raw ticks and StartTimeoutTicks() times out at the exact tick.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_TickFunctionsAreCalled_ReturnRawTicks) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_DOWN);
+
+  clockTickVal = 100;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+  sChrono testChrono;
+  fChronoClock_StartTimeoutTicks(&clock, &testChrono, 300);
+  clockTickVal = 0xFFFFU - 49U;
+  TEST_ASSERT_EQUAL_UINT64(149, fChronoClock_ElapsedTick(&clock, &testChrono));
+  TEST_ASSERT_EQUAL_UINT64(149000, fChronoClock_ElapsedNs(&clock, &testChrono));
+  TEST_ASSERT_EQUAL_UINT64(151, fChronoClock_LeftTick(&clock, &testChrono));
+  TEST_ASSERT_EQUAL_UINT64(151000, fChronoClock_LeftNs(&clock, &testChrono));
+  TEST_ASSERT_EQUAL_UINT64(149, fChronoClock_TimeSpanTick(&clock, 100, 0xFFFFU - 49U));
+  TEST_ASSERT_EQUAL_UINT64(149000, fChronoClock_TimeSpanNs(&clock, 100, 0xFFFFU - 49U));
+  TEST_ASSERT_EQUAL(false, fChronoClock_IsTimeout(&clock, &testChrono));
+
+  clockTickVal = 0xFFFFU - 200U;
+  TEST_ASSERT_EQUAL(true, fChronoClock_IsTimeout(&clock, &testChrono));
+  TEST_ASSERT_EQUAL_UINT64(0, fChronoClock_LeftTick(&clock, &testChrono));
+
+  fChronoClock_Start(&clock, &testChrono);
+  clockTickVal -= 7U;
+  TEST_ASSERT_EQUAL_UINT64(7, fChronoClock_IntervalTick(&clock, &testChrono));
+  clockTickVal -= 5U;
+  TEST_ASSERT_EQUAL_UINT64(5000, fChronoClock_IntervalNs(&clock, &testChrono));
+}
+
+/**
+ * @brief Returns the time span from "startTick" to "endTick" with the general wraparound of the tick, i.e., top - (start - end) on overflow.
+ * 
+ */
+static tick_t TimeSpanOfTop(tick_t top, uint8_t counterMode, tick_t startTick, tick_t endTick) {
+
+  if(counterMode == TICK_COUNTERMODE_DOWN) {
+    tick_t temp = startTick;
+    startTick = endTick;
+    endTick = temp;
+  }
+
+  return (endTick >= startTick) ? (endTick - startTick) : (top - (startTick - endTick));
+}
+
+/**
+ * @brief A clock with a 2^n-1 top value below the maximum of tick_t uses the masked time span. It must return the same spans
+ *        as the general wraparound, counting up and down, and the general path of a clock with another top value must match it too.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_TopValueIsMask_TimeSpanMatchesGeneralWraparound) {
+
+  sChronoClock maskedClock;
+  sChronoClock generalClock;
+  uint32_t seed = 99U;
+
+  for(uint8_t mode = 0; mode < 2U; mode++) {
+    uint8_t counterMode = (mode == 0U) ? TICK_COUNTERMODE_UP : TICK_COUNTERMODE_DOWN;
+    sChronoClockConfig maskedConfig = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, counterMode);
+    sChronoClockConfig generalConfig = TestClockConfig(GetClockTick, 50000U, 1000U, 1U, counterMode);
+
+    clockTickVal = 0;
+    TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&maskedClock, &maskedConfig));
+    TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&generalClock, &generalConfig));
+
+    /* The tick wraps around between the start and the end in the direction of counting. */
+    tick_t startTick = (counterMode == TICK_COUNTERMODE_UP) ? 0xFFF0U : 0x0010U;
+    tick_t endTick = (counterMode == TICK_COUNTERMODE_UP) ? 0x0010U : 0xFFF0U;
+    TEST_ASSERT_EQUAL_UINT32(0x1FU, fChronoClock_TimeSpanTick(&maskedClock, startTick, endTick));
+    TEST_ASSERT_EQUAL_UINT32(0x1FU, TimeSpanOfTop(0xFFFFU, counterMode, startTick, endTick));
+    TEST_ASSERT_EQUAL_UINT32(0U, fChronoClock_TimeSpanTick(&maskedClock, startTick, startTick));
+    if(counterMode == TICK_COUNTERMODE_UP) {
+      TEST_ASSERT_EQUAL_UINT32(0xFFFEU, fChronoClock_TimeSpanTick(&maskedClock, 0x10U, 0x0FU));
+    } else {
+      TEST_ASSERT_EQUAL_UINT32(0xFFFEU, fChronoClock_TimeSpanTick(&maskedClock, 0x0FU, 0x10U));
+    }
+
+    for(uint32_t i = 0; i < 1000U; i++) {
+      seed = (seed * 1103515245U) + 12345U;
+      tick_t a = (tick_t)((seed >> 8) & 0xFFFFU);
+      seed = (seed * 1103515245U) + 12345U;
+      tick_t b = (tick_t)((seed >> 8) & 0xFFFFU);
+
+      TEST_ASSERT_EQUAL_UINT32(TimeSpanOfTop(0xFFFFU, counterMode, a, b), fChronoClock_TimeSpanTick(&maskedClock, a, b));
+      a %= 50001U;
+      b %= 50001U;
+      TEST_ASSERT_EQUAL_UINT32(TimeSpanOfTop(50000U, counterMode, a, b), fChronoClock_TimeSpanTick(&generalClock, a, b));
+    }
+
+    /* A chrono object that is started before the wraparound reports the same elapsed ticks. */
+    sChrono testChrono;
+    clockTickVal = startTick;
+    fChronoClock_Start(&maskedClock, &testChrono);
+    clockTickVal = endTick;
+    TEST_ASSERT_EQUAL_UINT64(0x1FU, fChronoClock_ElapsedTick(&maskedClock, &testChrono));
+  }
+}
+
+/**
+ * @brief Deadline objects must time out at the same tick and report the same left ticks as chrono objects, for every start tick and timeout.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_DeadlineIsCompared_MatchesTimeoutOfChrono) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0x3FU, 1000U, 1U, TICK_COUNTERMODE_UP);
+
+  for(uint8_t mode = 0; mode < 2U; mode++) {
+    config.CounterMode = (mode == 0U) ? TICK_COUNTERMODE_UP : TICK_COUNTERMODE_DOWN;
+    clockTickVal = 0;
+    TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+    for(uint32_t start = 0; start <= 0x3FU; start++) {
+      for(uint32_t timeout = 0; timeout <= 0x3FU; timeout++) {
+        for(uint32_t now = 0; now <= 0x3FU; now++) {
+          sChrono testChrono;
+          sChronoDeadline testDeadline;
+
+          clockTickVal = start;
+          fChronoClock_StartTimeoutTicks(&clock, &testChrono, timeout);
+          fChronoClock_DeadlineStartTicks(&clock, &testDeadline, timeout);
+
+          clockTickVal = now;
+          TEST_ASSERT_EQUAL_UINT64(fChronoClock_LeftTick(&clock, &testChrono), fChronoClock_DeadlineLeftTick(&clock, &testDeadline));
+          TEST_ASSERT_EQUAL(fChronoClock_IsTimeout(&clock, &testChrono), fChronoClock_DeadlineIsTimeout(&clock, &testDeadline));
+        }
+      }
+    }
+  }
+
+  clockTickVal = 0;
+  sChronoDeadline testDeadline;
+  fChronoClock_DeadlineStartUs(&clock, &testDeadline, 10);
+  clockTickVal = 0x3FU - 4U;
+  TEST_ASSERT_EQUAL(false, fChronoClock_DeadlineIsTimeout(&clock, &testDeadline));
+  TEST_ASSERT_EQUAL_UINT32(6, fChronoClock_DeadlineLeftUs(&clock, &testDeadline));
+  clockTickVal = 0x3FU - 10U;
+  TEST_ASSERT_EQUAL(true, fChronoClock_DeadlineIsTimeout(&clock, &testDeadline));
+  clockTickVal = 0x3FU - 2U;
+  TEST_ASSERT_EQUAL(true, fChronoClock_DeadlineIsTimeout(&clock, &testDeadline));
+
+  fChronoClock_DeadlineStop(&clock, &testDeadline);
+  TEST_ASSERT_EQUAL(false, fChronoClock_DeadlineIsTimeout(&clock, &testDeadline));
+  TEST_ASSERT_EQUAL_UINT64(0, fChronoClock_DeadlineLeftNs(&clock, &testDeadline));
+}
+
+/**
+ * @brief Compact objects must time out at the same tick and report the same left ticks as chrono objects, and must be smaller than them.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_CompactIsCompared_MatchesTimeoutOfChrono) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0x3FU, 1000U, 1U, TICK_COUNTERMODE_UP);
+
+  TEST_ASSERT_EQUAL_UINT32(2U * sizeof(tick_t), fChrono_GetCompactRamUsage());
+  TEST_ASSERT_TRUE(fChrono_GetCompactRamUsage() < fChrono_GetChronoRamUsage());
+
+  for(uint8_t mode = 0; mode < 2U; mode++) {
+    config.CounterMode = (mode == 0U) ? TICK_COUNTERMODE_UP : TICK_COUNTERMODE_DOWN;
+    clockTickVal = 0;
+    TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+    for(uint32_t start = 0; start <= 0x3FU; start++) {
+      for(uint32_t timeout = 0; timeout <= 0x3FU; timeout++) {
+        sChrono testChrono;
+        sChronoCompact testCompact;
+
+        clockTickVal = start;
+        fChronoClock_StartTimeoutTicks(&clock, &testChrono, timeout);
+        fChronoClock_CompactStartTicks(&clock, &testCompact, timeout);
+
+        for(uint32_t step = 1; step <= 0x3FU; step++) {
+          clockTickVal = (mode == 0U) ? ((start + step) & 0x3FU) : ((start - step) & 0x3FU);
+          TEST_ASSERT_EQUAL_UINT64(fChronoClock_LeftTick(&clock, &testChrono), fChronoClock_CompactLeftTick(&clock, &testCompact));
+          TEST_ASSERT_EQUAL(fChronoClock_IsTimeout(&clock, &testChrono), fChronoClock_CompactIsTimeout(&clock, &testCompact));
+        }
+      }
+    }
+  }
+
+  sChronoCompact testCompact;
+  clockTickVal = 0x30U;
+  fChronoClock_CompactStartUs(&clock, &testCompact, 20);
+  clockTickVal -= 5U;
+  TEST_ASSERT_EQUAL_UINT32(15, fChronoClock_CompactLeftUs(&clock, &testCompact));
+  TEST_ASSERT_EQUAL_UINT64(15000, fChronoClock_CompactLeftNs(&clock, &testCompact));
+
+  fChronoClock_CompactStop(&clock, &testCompact);
+  TEST_ASSERT_EQUAL(false, fChronoClock_CompactIsTimeout(&clock, &testCompact));
+  TEST_ASSERT_EQUAL_UINT64(0, fChronoClock_CompactLeftTick(&clock, &testCompact));
+}
+
+/**
+ * @brief Compact objects must reject timeouts that don't fit next to their flags, and must not time out early because of them.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_CompactTimeoutIsTooLong_StartReturnFalse) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChronoCompact testCompact;
+
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+  /* The flags take the two most significant bits of a 32-bit tick, so the longest timeout is 2^30 - 1 ticks. */
+  TEST_ASSERT_TRUE(fChronoClock_CompactStartTicks(&clock, &testCompact, 0x3FFFFFFFU));
+  clockTickVal = 0x3FFFFFFEU;
+  TEST_ASSERT_EQUAL_UINT64(1U, fChronoClock_CompactLeftTick(&clock, &testCompact));
+  TEST_ASSERT_FALSE(fChronoClock_CompactIsTimeout(&clock, &testCompact));
+
+  /* A longer timeout stops the running compact object. */
+  clockTickVal = 0;
+  TEST_ASSERT_FALSE(fChronoClock_CompactStartTicks(&clock, &testCompact, 0x40000000U));
+  TEST_ASSERT_FALSE(fChronoClock_CompactIsTimeout(&clock, &testCompact));
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoClock_CompactLeftTick(&clock, &testCompact));
+
+  /* The limit applies to the converted timeout. */
+  TEST_ASSERT_TRUE(fChronoClock_CompactStartMs(&clock, &testCompact, 1073741U));
+  TEST_ASSERT_EQUAL_UINT32(1073741U, fChronoClock_CompactLeftMs(&clock, &testCompact));
+  TEST_ASSERT_FALSE(fChronoClock_CompactStartMs(&clock, &testCompact, 1073742U));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChronoClock_CompactLeftMs(&clock, &testCompact));
+}
+
+/**
+ * @brief Periods must be counted from the end of the previous period, so a late poll doesn't shift the next one.
+ *        Missed periods must be handled by the selected overrun policy.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_PeriodIsPolledLate_KeepsPhaseWithEachPolicy) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChrono periodic;
+  uint32_t missed;
+
+  for(uint8_t mode = 0; mode < 2U; mode++) {
+    config.CounterMode = (mode == 0U) ? TICK_COUNTERMODE_UP : TICK_COUNTERMODE_DOWN;
+    clockTickVal = (mode == 0U) ? 0U : 0xFFFFU;
+    TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+    /* Polled every 3 ticks, a 10 tick period runs 60 times in 600 ticks. Restarting the timeout would run it every 12 ticks. */
+    uint32_t runs = 0;
+    fChronoClock_StartTimeoutUs(&clock, &periodic, 10);
+    for(uint32_t t = 3; t <= 600U; t += 3U) {
+      clockTickVal = (mode == 0U) ? t : (0xFFFFU - t);
+      if(fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed)) {
+        TEST_ASSERT_EQUAL_UINT32(0, missed);
+        runs++;
+      }
+    }
+    TEST_ASSERT_EQUAL_UINT32(60, runs);
+
+    /* Catch up: the missed periods run back to back, then the phase is kept. */
+    clockTickVal = (mode == 0U) ? 635U : (0xFFFFU - 635U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed));
+    TEST_ASSERT_EQUAL_UINT32(2, missed);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed));
+    TEST_ASSERT_EQUAL_UINT32(1, missed);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed));
+    TEST_ASSERT_EQUAL_UINT32(0, missed);
+    TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed));
+    clockTickVal = (mode == 0U) ? 640U : (0xFFFFU - 640U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, NULL));
+
+    /* Skip: the missed periods are dropped and the next period keeps the phase. */
+    clockTickVal = (mode == 0U) ? 675U : (0xFFFFU - 675U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+    TEST_ASSERT_EQUAL_UINT32(2, missed);
+    TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+    clockTickVal = (mode == 0U) ? 679U : (0xFFFFU - 679U);
+    TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+    clockTickVal = (mode == 0U) ? 680U : (0xFFFFU - 680U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+    TEST_ASSERT_EQUAL_UINT32(0, missed);
+
+    /* Coalesce: the missed periods are dropped and the next period starts from the late poll. */
+    clockTickVal = (mode == 0U) ? 715U : (0xFFFFU - 715U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_COALESCE, &missed));
+    TEST_ASSERT_EQUAL_UINT32(2, missed);
+    clockTickVal = (mode == 0U) ? 724U : (0xFFFFU - 724U);
+    TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_COALESCE, &missed));
+    clockTickVal = (mode == 0U) ? 725U : (0xFFFFU - 725U);
+    TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_COALESCE, &missed));
+    TEST_ASSERT_EQUAL_UINT32(0, missed);
+
+    fChronoClock_Stop(&clock, &periodic);
+    TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_CATCH_UP, &missed));
+  }
+
+  /* The next period is counted over the overflow of the tick generator. */
+  config.CounterMode = TICK_COUNTERMODE_UP;
+  clockTickVal = 0xFFFFU - 5U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  fChronoClock_StartTimeoutTicks(&clock, &periodic, 10);
+  clockTickVal = 5U;
+  TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+  clockTickVal = 14U;
+  TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+  clockTickVal = 15U;
+  TEST_ASSERT_EQUAL(true, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+
+  fChronoClock_StartTimeoutTicks(&clock, &periodic, 0);
+  TEST_ASSERT_EQUAL(false, fChronoClock_IsPeriodDue(&clock, &periodic, CHRONO_OVERRUN_SKIP, &missed));
+}
+
+/**
+ * @brief Tick value of the reference clock in the calibration test.
+ * 
+ */
+static uint32_t referenceTickVal;
+
+/**
+ * @brief Ticks of the user clock per tick of the reference clock in the calibration tests.
+ * 
+ */
+static uint32_t clockTickPerReference;
+
+/**
+ * @brief Returns the tick value of the reference clock. Each read advances the reference by one tick and the user clock by clockTickPerReference ticks,
+ *        so the user clock counts at clockTickPerReference times the frequency of the reference.
+ * 
+ */
+static tick_t GetReferenceTick(void) {
+  referenceTickVal++;
+  clockTickVal += clockTickPerReference;
+  return referenceTickVal;
+}
+
+/**
+ * @brief A clock with a wrong tick period is calibrated against a reference clock and then converts its ticks with the measured period.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_CalibrateAgainstReference_SetsMeasuredFrequency) {
+
+  sChronoClock clock;
+  sChronoClock reference;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChronoCalibration calibration;
+
+  clockTickVal = 0xFFFFF000U;
+  referenceTickVal = 0;
+  clockTickPerReference = 3U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  config.GetTickValue = GetReferenceTick;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&reference, &config));
+
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_CALIBRATION, fChronoClock_Calibrate(&clock, &reference, 0U, &calibration));
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_CALIBRATION, fChronoClock_Calibrate(&clock, &reference, 500U, &calibration));
+  TEST_ASSERT_EQUAL(CHRONO_ERROR_TICK_PTR_ERROR, fChronoClock_Calibrate(&clock, NULL, 1000000U, &calibration));
+
+  /* 1 ms of the 1 MHz reference. The user clock overflows during the window. */
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Calibrate(&clock, &reference, 1000000U, &calibration));
+  TEST_ASSERT_EQUAL_UINT64(3000000U, calibration.FrequencyHz);
+  TEST_ASSERT_EQUAL_UINT64(3000U, calibration.Ticks);
+  TEST_ASSERT_EQUAL_UINT64(1000000U, calibration.ReferenceNs);
+
+  /* Each edge is known within two reads of the reference, i.e., 6 ticks. */
+  TEST_ASSERT_EQUAL_UINT32(2002U, calibration.ErrorPpm);
+
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChronoClock_TimeSpanUs(&clock, 0U, 3000U));
+  TEST_ASSERT_EQUAL_UINT64(3000U, fChronoClock_TimeSpanNs(&clock, 0U, 9U));
+  TEST_ASSERT_EQUAL_UINT32(1000000000U, clock._tickPeriodNum);
+  TEST_ASSERT_EQUAL_UINT32(3000000U, clock._tickPeriodDen);
+}
+
+/**
+ * @brief A clock faster than 4.29 GHz is calibrated. Its frequency doesn't fit in 32 bits, so the tick period is reduced to fit.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_CalibrateAbove4GHz_ReducesTickPeriod) {
+
+  sChronoClock clock;
+  sChronoClock reference;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1U, 4U, TICK_COUNTERMODE_UP);
+  sChronoCalibration calibration;
+
+  /* 4.5 GHz against a 1 MHz reference. The period 1e9 / 4.5e9 ns is reduced by the gcd to 2 / 9 ns. */
+  clockTickVal = 0;
+  referenceTickVal = 0;
+  clockTickPerReference = 4500U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  config.GetTickValue = GetReferenceTick;
+  config.TickPeriodNum = 1000U;
+  config.TickPeriodDen = 1U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&reference, &config));
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Calibrate(&clock, &reference, 1000000U, &calibration));
+  TEST_ASSERT_EQUAL_UINT64(4500000000U, calibration.FrequencyHz);
+  TEST_ASSERT_EQUAL_UINT32(2U, clock._tickPeriodNum);
+  TEST_ASSERT_EQUAL_UINT32(9U, clock._tickPeriodDen);
+  TEST_ASSERT_EQUAL_UINT64(2U, fChronoClock_TimeSpanNs(&clock, 0U, 9U));
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChronoClock_TimeSpanUs(&clock, 0U, 4500000U));
+
+  /* A 999 ns reference gives an odd frequency, so the period is also rounded to fit. */
+  clockTickVal = 0;
+  referenceTickVal = 0;
+  clockTickPerReference = 4498U;
+  config.TickPeriodNum = 999U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&reference, &config));
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Calibrate(&clock, &reference, 1000000U, &calibration));
+  TEST_ASSERT_EQUAL_UINT64(4502502503U, calibration.FrequencyHz);
+  TEST_ASSERT_EQUAL_UINT32(500000000U, clock._tickPeriodNum);
+  TEST_ASSERT_EQUAL_UINT32(2251251252U, clock._tickPeriodDen);
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChronoClock_TimeSpanUs(&clock, 0U, 4502503U));
+}
+
+/**
+ * @brief Clock tick of the last call to fChronoWheel_Advance() before the current one.
+ * 
+ */
+static uint32_t wheelPrevTick;
+
+/**
+ * @brief Clock tick at which each wheel timer expired, or zero if it has not expired.
+ * 
+ */
+static uint32_t wheelFiredTick[96];
+
+/**
+ * @brief Records the tick at which the wheel timer expired. The index of the timer is passed as the argument.
+ * 
+ */
+static void WheelCallback(sChronoWheelTimer * const timer, void *arg) {
+
+  (void)timer;
+  wheelFiredTick[(uintptr_t)arg] = clockTickVal;
+}
+
+/**
+ * @brief Re-arms the wheel timer from its own callback, so it works as a periodic timer.
+ * 
+ */
+static void WheelPeriodicCallback(sChronoWheelTimer * const timer, void *arg) {
+
+  sChronoWheel *wheel = (sChronoWheel*)arg;
+
+  wheelFiredTick[0]++;
+  fChronoWheel_Arm(wheel, timer, 100, WheelPeriodicCallback, arg);
+}
+
+/**
+ * @brief Timers of the wheel must expire on the first call to fChronoWheel_Advance() after their timeout, in every level of the wheel,
+ *        and cancelled timers must not expire.
+ * 
+ */
+TEST(GROUP_1, ChronoWheel_TimersAreArmed_ExpireOnFirstAdvanceAfterTimeout) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  static sChronoWheel wheel;
+  static sChronoWheelTimer timer[96];
+  uint32_t timeout[96];
+  uint32_t seed = 12345U;
+
+  clockTickVal = 0xFFF00000U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_WHEEL_ERROR_RESOLUTION, fChronoWheel_Init(&wheel, &clock, 0));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoWheel_Init(&wheel, &clock, 10));
+
+  for(uint32_t i = 0; i < ArraySize_(timer); i++) {
+    seed = (seed * 1103515245U) + 12345U;
+    timeout[i] = 1U + ((seed >> 8) % (1UL << (6U * (i % 5U) + 4U)));
+    wheelFiredTick[i] = 0;
+    fChronoWheel_Arm(&wheel, &timer[i], timeout[i], WheelCallback, (void*)(uintptr_t)i);
+  }
+  for(uint32_t i = 0; i < ArraySize_(timer); i += 8U) {
+    fChronoWheel_Cancel(&wheel, &timer[i]);
+  }
+  fChronoWheel_Arm(&wheel, &timer[1], 25, NULL, NULL);
+  TEST_ASSERT_EQUAL_UINT32(ArraySize_(timer) - 12U, fChronoWheel_GetCount(&wheel));
+
+  uint32_t startTick = clockTickVal;
+  uint32_t expired = 0;
+  while((clockTickVal - startTick) < 0x50000000U) {
+    wheelPrevTick = clockTickVal;
+    seed = (seed * 1103515245U) + 12345U;
+    clockTickVal += 1U + ((seed >> 8) % 0x40000U);
+    expired += fChronoWheel_Advance(&wheel);
+
+    for(uint32_t i = 0; i < ArraySize_(timer); i++) {
+      uint32_t deadline = startTick + ((timeout[i] + 9U) / 10U) * 10U;
+      if(wheelFiredTick[i] != 0U) {
+        TEST_ASSERT_TRUE((wheelFiredTick[i] - startTick) >= (deadline - startTick));
+        TEST_ASSERT_TRUE((wheelPrevTick - startTick) < (deadline - startTick));
+        wheelFiredTick[i] = 0;
+        timeout[i] = 0xFFFFFFFFU;
+      }
+    }
+  }
+
+  for(uint32_t i = 0; i < ArraySize_(timer); i++) {
+    if(((i % 8U) == 0U) || (i == 1U)) {
+      TEST_ASSERT_TRUE(timeout[i] != 0xFFFFFFFFU);
+    } else {
+      TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU, timeout[i]);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(ArraySize_(timer) - 12U, expired);
+  TEST_ASSERT_EQUAL_UINT32(0, fChronoWheel_GetCount(&wheel));
+  TEST_ASSERT_TRUE(fChronoWheel_IsExpired(&timer[1]));
+  TEST_ASSERT_EQUAL_PTR(&timer[1], fChronoWheel_GetExpired(&wheel));
+  TEST_ASSERT_NULL(fChronoWheel_GetExpired(&wheel));
+}
+
+/**
+ * @brief A wheel timer that re-arms itself from its callback must expire once per period, and re-arming must move its expiry.
+ * 
+ */
+TEST(GROUP_1, ChronoWheel_TimerIsReArmed_ExpiresOncePerPeriod) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  static sChronoWheel wheel;
+  sChronoWheelTimer periodic = {0};
+  sChronoWheelTimer watchdog = {0};
+
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoWheel_Init(&wheel, &clock, 1));
+
+  wheelFiredTick[0] = 0;
+  wheelFiredTick[1] = 0;
+  fChronoWheel_Arm(&wheel, &periodic, 100, WheelPeriodicCallback, &wheel);
+  fChronoWheel_Arm(&wheel, &watchdog, 150, WheelCallback, (void*)(uintptr_t)1);
+
+  for(uint32_t i = 0; i < 1000U; i++) {
+    clockTickVal++;
+    fChronoWheel_Advance(&wheel);
+    if((i % 100U) == 50U) {
+      fChronoWheel_Arm(&wheel, &watchdog, 150, WheelCallback, (void*)(uintptr_t)1);
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(10, wheelFiredTick[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, wheelFiredTick[1]);
+  TEST_ASSERT_TRUE(fChronoWheel_IsArmed(&watchdog));
+
+  clockTickVal += 150U;
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoWheel_Advance(&wheel));
+  TEST_ASSERT_EQUAL_UINT32(clockTickVal, wheelFiredTick[1]);
+  TEST_ASSERT_FALSE(fChronoWheel_IsArmed(&watchdog));
+}
+
+/**
+ * @brief Number of calls to SchedCallback() for each scheduler entry, the deadline that each one-shot entry was started with,
+ *        and the deadline of the last call.
+ * 
+ */
+static uint32_t schedRuns[40];
+static uint32_t schedDeadline[40];
+static uint32_t schedLastTick;
+
+/**
+ * @brief Counts the runs of the scheduler entry and checks that one-shot entries run in the order of their deadlines.
+ *        Periodic entries have a zero deadline in schedDeadline, so the check always passes for them.
+ * 
+ */
+static void SchedCallback(sChronoSchedEntry * const entry, void *arg) {
+
+  (void)entry;
+  TEST_ASSERT_TRUE(schedDeadline[(uintptr_t)arg] >= schedLastTick);
+  schedLastTick = schedDeadline[(uintptr_t)arg];
+  schedRuns[(uintptr_t)arg]++;
+}
+
+/**
+ * @brief A loop that only wakes up when fChronoSched_NextDeadlineTicks() returns zero must run each periodic entry once per period.
+ * 
+ */
+TEST(GROUP_1, ChronoSched_LoopSleepsUntilNextDeadline_RunsEachEntryOncePerPeriod) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChronoSched sched;
+  sChronoSchedEntry *heap[3];
+  sChronoSchedEntry entry[4] = {0};
+  uint32_t wakeups = 0;
+
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_SCHED_ERROR_HEAP, fChronoSched_Init(&sched, &clock, heap, 0));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoSched_Init(&sched, &clock, heap, ArraySize_(heap)));
+  TEST_ASSERT_EQUAL_UINT64(CHRONO_SCHED_NO_DEADLINE, fChronoSched_NextDeadlineTicks(&sched));
+
+  schedLastTick = 0;
+  for(uint32_t i = 0; i < 3U; i++) {
+    schedRuns[i] = 0;
+    schedDeadline[i] = 0;
+    TEST_ASSERT_TRUE(fChronoSched_Start(&sched, &entry[i], 30U + (20U * i), 30U + (20U * i), SchedCallback, (void*)(uintptr_t)i));
+  }
+  TEST_ASSERT_FALSE(fChronoSched_Start(&sched, &entry[3], 1, 0, SchedCallback, NULL));
+  TEST_ASSERT_EQUAL_UINT64(30, fChronoSched_NextDeadlineTicks(&sched));
+
+  for(uint32_t tick = 0; tick < 1050U; tick++) {
+    if(fChronoSched_NextDeadlineTicks(&sched) == 0U) {
+      wakeups++;
+      TEST_ASSERT_TRUE(fChronoSched_Run(&sched) != 0U);
+    }
+    clockTickVal++;
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(34, schedRuns[0]);
+  TEST_ASSERT_EQUAL_UINT32(20, schedRuns[1]);
+  TEST_ASSERT_EQUAL_UINT32(14, schedRuns[2]);
+  TEST_ASSERT_EQUAL_UINT32(34 + 20 + 14 - 6 - 4 - 2, wakeups);
+
+  fChronoSched_Stop(&sched, &entry[1]);
+  TEST_ASSERT_FALSE(fChronoSched_IsScheduled(&entry[1]));
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoSched_GetCount(&sched));
+
+  clockTickVal += 100U;
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoSched_Run(&sched));
+  TEST_ASSERT_EQUAL_UINT64(20, fChronoSched_NextDeadlineTicks(&sched));
+}
+
+/**
+ * @brief One-shot entries with random delays must run in the order of their deadlines, and stopped entries must not run.
+ * 
+ */
+TEST(GROUP_1, ChronoSched_OneShotEntriesAreStarted_RunInDeadlineOrder) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChronoSched sched;
+  sChronoSchedEntry *heap[40];
+  static sChronoSchedEntry entry[40];
+  uint32_t seed = 7U;
+
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoSched_Init(&sched, &clock, heap, ArraySize_(heap)));
+
+  schedLastTick = 0;
+  for(uint32_t i = 0; i < ArraySize_(entry); i++) {
+    seed = (seed * 1103515245U) + 12345U;
+    schedRuns[i] = 0;
+    schedDeadline[i] = (seed >> 8) % 1000U;
+    TEST_ASSERT_TRUE(fChronoSched_Start(&sched, &entry[i], schedDeadline[i], 0, SchedCallback, (void*)(uintptr_t)i));
+  }
+  for(uint32_t i = 0; i < ArraySize_(entry); i += 3U) {
+    fChronoSched_Stop(&sched, &entry[i]);
+  }
+  schedDeadline[4] = 2000U;
+  TEST_ASSERT_TRUE(fChronoSched_Start(&sched, &entry[4], 2000, 0, SchedCallback, (void*)(uintptr_t)4));
+
+  uint32_t runs = 0;
+  for(uint32_t tick = 0; tick < 1000U; tick += 7U) {
+    clockTickVal = tick;
+    runs += fChronoSched_Run(&sched);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(ArraySize_(entry) - 14U - 1U, runs);
+  for(uint32_t i = 0; i < ArraySize_(entry); i++) {
+    TEST_ASSERT_EQUAL_UINT32((((i % 3U) == 0U) || (i == 4U)) ? 0U : 1U, schedRuns[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, fChronoSched_GetCount(&sched));
+  TEST_ASSERT_EQUAL_UINT64(2000 - 994, fChronoSched_NextDeadlineTicks(&sched));
+}
+
+/**
+ * @brief Order of the executor tasks that ran, and the number of ticks that each task takes.
+ * 
+ */
+static uint32_t execOrder[8];
+static uint32_t execOrderCount;
+static uint32_t const execCost[3] = {2, 3, 0};
+
+/**
+ * @brief Records the executor task that runs and advances the clock by its execution time. The index of the task is passed as the argument.
+ * 
+ */
+static void ExecCallback(void *arg) {
+
+  uint32_t index = (uint32_t)(uintptr_t)arg;
+
+  if(execOrderCount < ArraySize_(execOrder)) {
+    execOrder[execOrderCount++] = index;
+  }
+  clockTickVal += execCost[index];
+}
+
+/**
+ * @brief Due tasks must run in the order of their deadlines and priorities, and their execution time, lateness and overruns must be recorded.
+ * 
+ */
+TEST(GROUP_1, ChronoExec_TasksAreDue_RunInDeadlineOrderAndRecordStats) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  sChronoExec exec;
+  sChronoExecTask table[3];
+  sChronoExecTask *task[3];
+  sChronoExecStats stats;
+
+  clockTickVal = 0;
+  execOrderCount = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_EXEC_ERROR_TABLE, fChronoExec_Init(&exec, &clock, NULL, 3));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoExec_Init(&exec, &clock, table, ArraySize_(table)));
+  TEST_ASSERT_EQUAL_UINT64(CHRONO_EXEC_NO_DEADLINE, fChronoExec_NextDeadlineTicks(&exec));
+
+  TEST_ASSERT_NULL(fChronoExec_Add(&exec, 0, 1, ExecCallback, NULL));
+  task[0] = fChronoExec_Add(&exec, 10, 1, ExecCallback, (void*)(uintptr_t)0);
+  task[1] = fChronoExec_Add(&exec, 10, 5, ExecCallback, (void*)(uintptr_t)1);
+  task[2] = fChronoExec_Add(&exec, 25, 0, ExecCallback, (void*)(uintptr_t)2);
+  TEST_ASSERT_NOT_NULL(task[2]);
+  TEST_ASSERT_NULL(fChronoExec_Add(&exec, 10, 1, ExecCallback, NULL));
+  TEST_ASSERT_EQUAL_UINT32(3, fChronoExec_GetCount(&exec));
+  TEST_ASSERT_EQUAL_UINT64(10, fChronoExec_NextDeadlineTicks(&exec));
+
+  /* Same deadline: the higher priority runs first, so task 0 starts 3 ticks late. */
+  clockTickVal = 10;
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoExec_Run(&exec));
+  clockTickVal = 20;
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoExec_Run(&exec));
+  TEST_ASSERT_EQUAL_UINT32(0, fChronoExec_NextDeadlineTicks(&exec));
+  TEST_ASSERT_EQUAL_UINT32(1, fChronoExec_Run(&exec));
+  TEST_ASSERT_EQUAL_UINT32(0, fChronoExec_Run(&exec));
+
+  /* All tasks are late. Each runs once in the order of its deadline and the missed periods are overruns. */
+  clockTickVal = 57;
+  TEST_ASSERT_EQUAL_UINT32(3, fChronoExec_Run(&exec));
+  TEST_ASSERT_EQUAL_UINT32(62, clockTickVal);
+
+  uint32_t const expectedOrder[] = {1, 0, 1, 0, 2, 1, 0, 2};
+  TEST_ASSERT_EQUAL_UINT32(ArraySize_(expectedOrder), execOrderCount);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(expectedOrder, execOrder, ArraySize_(expectedOrder));
+
+  fChronoExec_GetStats(task[0], &stats);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.Runs);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.Overruns);
+  TEST_ASSERT_EQUAL_UINT64(2, stats.ExecMin);
+  TEST_ASSERT_EQUAL_UINT64(2, stats.ExecMax);
+  TEST_ASSERT_EQUAL_UINT64(6, stats.ExecTotal);
+  TEST_ASSERT_EQUAL_UINT64(3, stats.LatenessMin);
+  TEST_ASSERT_EQUAL_UINT64(30, stats.LatenessMax);
+  TEST_ASSERT_EQUAL_UINT64(36, stats.LatenessTotal);
+
+  fChronoExec_GetStats(task[1], &stats);
+  TEST_ASSERT_EQUAL_UINT32(3, stats.Runs);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.Overruns);
+  TEST_ASSERT_EQUAL_UINT64(3, stats.ExecLast);
+  TEST_ASSERT_EQUAL_UINT64(0, stats.LatenessMin);
+  TEST_ASSERT_EQUAL_UINT64(27, stats.LatenessMax);
+
+  fChronoExec_GetStats(task[2], &stats);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.Runs);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.Overruns);
+  TEST_ASSERT_EQUAL_UINT64(12, stats.LatenessMax);
+
+  /* Task 1 is due again at tick 60. Suspended tasks don't run, and a resumed task runs one period later. */
+  TEST_ASSERT_EQUAL_UINT64(0, fChronoExec_NextDeadlineTicks(&exec));
+  fChronoExec_Suspend(task[1]);
+  TEST_ASSERT_EQUAL_UINT64(8, fChronoExec_NextDeadlineTicks(&exec));
+  fChronoExec_Resume(&exec, task[1]);
+  fChronoExec_Suspend(task[0]);
+  TEST_ASSERT_EQUAL_UINT64(10, fChronoExec_NextDeadlineTicks(&exec));
+
+  fChronoExec_ResetStats(task[0]);
+  fChronoExec_GetStats(task[0], &stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.Runs);
+  TEST_ASSERT_EQUAL_UINT64(0, stats.LatenessMax);
+}
+
+/**
+ * @brief Software timers of the timer test, and the number of times each of them expired.
+ * 
+ */
+static sChronoTimer timers[4];
+static uint32_t timerFires[4];
+
+/**
+ * @brief Counts the expiries of the software timer. Timer 1 stops timer 2 and timer 3 restarts itself. The index of the timer is passed as the context.
+ * 
+ */
+static void TimerCallback(sChronoTimer * const timer, void *context) {
+
+  uint32_t index = (uint32_t)(uintptr_t)context;
+
+  timerFires[index]++;
+  if(index == 1U) {
+    fChronoTimer_Stop(&timers[2]);
+  } else if(index == 3U) {
+    (void)fChronoTimer_Restart(timer);
+  }
+}
+
+/**
+ * @brief One-shot and periodic timers must expire at their deadlines, and callbacks must be able to stop and restart timers.
+ * 
+ */
+TEST(GROUP_1, ChronoTimer_TimersAreProcessedEveryTick_ExpireAtTheirDeadlines) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+
+  clockTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL(CHRONO_TIMER_ERROR_CLOCK, fChronoTimer_Init(NULL));
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoTimer_Init(&clock));
+  TEST_ASSERT_EQUAL_UINT64(CHRONO_TIMER_NO_DEADLINE, fChronoTimer_NextDeadlineTicks());
+
+  for(uint32_t i = 0; i < ArraySize_(timers); i++) {
+    timers[i] = (sChronoTimer){0};
+    timerFires[i] = 0;
+  }
+  TEST_ASSERT_TRUE(fChronoTimer_Start(&timers[0], 30, 30, TimerCallback, (void*)(uintptr_t)0));
+  TEST_ASSERT_TRUE(fChronoTimer_Start(&timers[1], 45, 0, TimerCallback, (void*)(uintptr_t)1));
+  TEST_ASSERT_TRUE(fChronoTimer_Start(&timers[2], 5, 20, TimerCallback, (void*)(uintptr_t)2));
+  TEST_ASSERT_TRUE(fChronoTimer_Start(&timers[3], 100, 0, TimerCallback, (void*)(uintptr_t)3));
+  TEST_ASSERT_EQUAL_UINT32(4, fChronoTimer_GetCount());
+  TEST_ASSERT_EQUAL_UINT64(5, fChronoTimer_NextDeadlineTicks());
+
+  /* Timer 1 and timer 2 both expire at tick 45. Timer 1 was started first, so it runs first and stops timer 2. */
+  for(uint32_t tick = 0; tick < 300U; tick++) {
+    clockTickVal = tick;
+    (void)fChronoTimer_Process();
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(9, timerFires[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, timerFires[1]);
+  TEST_ASSERT_EQUAL_UINT32(2, timerFires[2]);
+  TEST_ASSERT_EQUAL_UINT32(2, timerFires[3]);
+  TEST_ASSERT_FALSE(fChronoTimer_IsActive(&timers[1]));
+  TEST_ASSERT_FALSE(fChronoTimer_IsActive(&timers[2]));
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoTimer_GetCount());
+
+  /* Processed late, the periodic timer expires once and keeps its phase. */
+  clockTickVal = 400;
+  TEST_ASSERT_EQUAL_UINT32(2, fChronoTimer_Process());
+  TEST_ASSERT_EQUAL_UINT32(0, fChronoTimer_Process());
+  TEST_ASSERT_EQUAL_UINT64(20, fChronoTimer_NextDeadlineTicks());
+
+  fChronoTimer_Stop(&timers[0]);
+  fChronoTimer_Stop(&timers[0]);
+  TEST_ASSERT_EQUAL_UINT64(100, fChronoTimer_NextDeadlineTicks());
+  TEST_ASSERT_EQUAL_UINT32(1, fChronoTimer_GetCount());
+}
+
+/**
+ * @brief The clock that is read again from inside its own tick function.
+ * 
+ */
+static sChronoClock nestedClock;
+
+/**
+ * @brief Result of the nested read of nestedClock.
+ * 
+ */
+static uint64_t nestedTick64;
+
+/**
+ * @brief Number of pending nested reads of nestedClock.
+ * 
+ */
+static uint8_t nestedReads;
+
+/**
+ * @brief Returns the tick of nestedClock, and acts like an interrupt that reads the same clock in the middle of fChronoClock_GetTick64().
+ * 
+ */
+static tick_t GetNestedClockTick(void) {
+
+  if(nestedReads > 0U) {
+    nestedReads--;
+    clockTickVal += 10U;
+    nestedTick64 = fChronoClock_GetTick64(&nestedClock);
+  }
+
+  return clockTickVal;
+}
+
+/**
+ * @brief fChronoClock_GetTick64() must count overflows of the tick and must stay consistent when it is called again before it returns.
+ * 
+ */
+TEST(GROUP_1, ChronoClock_GetTick64IsCalledFromNestedContext_ReturnContinuousTick) {
+
+  sChronoClockConfig config = TestClockConfig(GetNestedClockTick, 0xFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+
+  clockTickVal = 0xFFF0U;
+  nestedReads = 0U;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&nestedClock, &config));
+  TEST_ASSERT_EQUAL_UINT64(0, fChronoClock_GetTick64(&nestedClock));
+
+  clockTickVal = 0x0010U;
+  TEST_ASSERT_EQUAL_UINT64(0x1F, fChronoClock_GetTick64(&nestedClock));
+
+  uint32_t i;
+  for(i = 0; i < 3U; i++) {
+    clockTickVal = 0x8010U;
+    fChronoClock_GetTick64(&nestedClock);
+    clockTickVal = 0x0010U;
+    fChronoClock_GetTick64(&nestedClock);
+  }
+  TEST_ASSERT_EQUAL_UINT64(0x3001C, fChronoClock_GetTick64(&nestedClock));
+
+  nestedReads = 1U;
+  uint64_t tick64 = fChronoClock_GetTick64(&nestedClock);
+  TEST_ASSERT_EQUAL_UINT64(0x30026, nestedTick64);
+  TEST_ASSERT_EQUAL_UINT64(0x30026, tick64);
+
+  clockTickVal = 0x8010U;
+  TEST_ASSERT_EQUAL_UINT64(0x3801C, fChronoClock_GetTick64(&nestedClock));
+
+  clockTickVal = 0x0010U;
+  nestedReads = 2U;
+  tick64 = fChronoClock_GetTick64(&nestedClock);
+  TEST_ASSERT_EQUAL_UINT64(0x4002F, nestedTick64);
+  TEST_ASSERT_EQUAL_UINT64(0x4002F, tick64);
+  TEST_ASSERT_EQUAL_UINT64(0x4002F, fChronoClock_GetTick64(&nestedClock));
+}
+
 /**
  * @brief Test group runner.
  * 
@@ -643,6 +1782,25 @@ TEST_GROUP_RUNNER(GROUP_1) {
   RUN_TEST_CASE(GROUP_1, Chrono_IntervalUsIsCalledWhenChronoIsNotInit_ReturnZero);
   RUN_TEST_CASE(GROUP_1, Chrono_IntervalUsIsCalledWhenChronoIsNotRun_ReturnZero);
   RUN_TEST_CASE(GROUP_1, Chrono_IntervalUsIsCalledWhenChronoIsInit_ReturnInterval);
+  RUN_TEST_CASE(GROUP_1, ChronoEx_RunEveryStatsBlockIsDelayed_RecordsPeriodJitterAndMisses);
+  RUN_TEST_CASE(GROUP_1, ChronoEx_TaskAwaitsDelayAndCondition_ResumesFromLastWait);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_InitWithInvalidConfig_InitReturnError);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_TwoClocksAreUsedTogether_EachClockUsesItsOwnTick);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_GetTick64IsCalledFromNestedContext_ReturnContinuousTick);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_TickFunctionsAreCalled_ReturnRawTicks);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_TopValueIsMask_TimeSpanMatchesGeneralWraparound);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_DeadlineIsCompared_MatchesTimeoutOfChrono);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_CompactIsCompared_MatchesTimeoutOfChrono);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_CompactTimeoutIsTooLong_StartReturnFalse);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_PeriodIsPolledLate_KeepsPhaseWithEachPolicy);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_CalibrateAgainstReference_SetsMeasuredFrequency);
+  RUN_TEST_CASE(GROUP_1, ChronoClock_CalibrateAbove4GHz_ReducesTickPeriod);
+  RUN_TEST_CASE(GROUP_1, ChronoWheel_TimersAreArmed_ExpireOnFirstAdvanceAfterTimeout);
+  RUN_TEST_CASE(GROUP_1, ChronoWheel_TimerIsReArmed_ExpiresOncePerPeriod);
+  RUN_TEST_CASE(GROUP_1, ChronoSched_LoopSleepsUntilNextDeadline_RunsEachEntryOncePerPeriod);
+  RUN_TEST_CASE(GROUP_1, ChronoSched_OneShotEntriesAreStarted_RunInDeadlineOrder);
+  RUN_TEST_CASE(GROUP_1, ChronoExec_TasksAreDue_RunInDeadlineOrderAndRecordStats);
+  RUN_TEST_CASE(GROUP_1, ChronoTimer_TimersAreProcessedEveryTick_ExpireAtTheirDeadlines);
 
 }
 
@@ -1529,6 +2687,28 @@ TEST(GROUP_6, Chrono_IntervalMsIsCalledWhenChronoIsInit_ReturnInterval) {
 
 }
 
+/**
+ * @brief Microsecond functions are available when the tick period is longer than one microsecond.
+ * 
+ */
+TEST(GROUP_6, Chrono_TickPeriodIsLongerThanMicrosecond_UsFunctionsAreAvailable) {
+
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  TEST_ASSERT_TRUE(fChrono_IsTickUsAvailable());
+  TEST_ASSERT_EQUAL_UINT32(3000U, fChrono_TimeSpanUs(0, 3));
+
+  tickVal = 0;
+  fChrono_StartTimeoutUs(&testChrono, 2000);
+  tickVal = 1;
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChrono_LeftUs(&testChrono));
+  tickVal = 2;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+
+}
+
 /**
  * @brief Test group runner.
  * 
@@ -1547,6 +2727,7 @@ TEST_GROUP_RUNNER(GROUP_6) {
   RUN_TEST_CASE(GROUP_6, Chrono_IntervalMsIsCalledWhenChronoIsNotInit_ReturnZero);
   RUN_TEST_CASE(GROUP_6, Chrono_IntervalMsIsCalledWhenChronoIsNotRun_ReturnZero);
   RUN_TEST_CASE(GROUP_6, Chrono_IntervalMsIsCalledWhenChronoIsInit_ReturnInterval);
+  RUN_TEST_CASE(GROUP_6, Chrono_TickPeriodIsLongerThanMicrosecond_UsFunctionsAreAvailable);
 
 }
 
@@ -1643,6 +2824,7 @@ TEST(GROUP_7, ChronoLong_ElapsedMsIsCalledWhenTickIsOverflowedMultipleTimes_Retu
 
   timeMs_t elapsed = 0;
   sChronoLong testChrono = {0x00};
+  tickVal = 0;
 
   fChrono_Init(&tickVal); // It takes 4.294967296 seconds to overflow the tick generator.
 
@@ -1681,11 +2863,11 @@ TEST(GROUP_7, ChronoLong_ElapsedMsIsCalledWhenTickIsOverflowedMultipleTimes_Retu
 
   tickVal = 0; // This is the second overflow. It equals 8.589934591 seconds.
   elapsed = fChronoLong_ElapsedMs(&testChrono);
-  TEST_ASSERT_EQUAL_UINT32(8588, elapsed);
+  TEST_ASSERT_EQUAL_UINT32(8589, elapsed);
 
   tickVal = 420000000;
   elapsed = fChronoLong_ElapsedMs(&testChrono);
-  TEST_ASSERT_EQUAL_UINT32(9008, elapsed);
+  TEST_ASSERT_EQUAL_UINT32(9009, elapsed);
 
 }
 
@@ -1697,6 +2879,7 @@ TEST(GROUP_7, ChronoLong_LeftSIsCalledWhenTickIsOverflowedMultipleTimes_ReturnsC
 
   uint32_t left = 0;
   sChronoLong testChrono = {0x00};
+  tickVal = 0;
 
   fChrono_Init(&tickVal); // It takes 4.294967296 seconds to overflow the tick generator.
 
@@ -1737,6 +2920,7 @@ TEST(GROUP_7, ChronoLong_LeftMsIsCalledWhenTickIsOverflowedMultipleTimes_Returns
 
   timeMs_t left = 0;
   sChronoLong testChrono = {0x00};
+  tickVal = 0;
 
   fChrono_Init(&tickVal); // It takes 4.294967296 seconds to overflow the tick generator.
 
@@ -1758,7 +2942,7 @@ TEST(GROUP_7, ChronoLong_LeftMsIsCalledWhenTickIsOverflowedMultipleTimes_Returns
 
   tickVal = 0; // This is the second overflow. It equals 8.589934591 seconds.
   left = fChronoLong_LeftMs(&testChrono);
-  TEST_ASSERT_EQUAL_FLOAT(1412, left);
+  TEST_ASSERT_EQUAL_FLOAT(1411, left);
   
   tickVal = 0xFFFFFFFF;
   fChronoLong_LeftS(&testChrono);
@@ -1777,6 +2961,7 @@ TEST(GROUP_7, ChronoLong_TimeoutSWithVeryLongDuration_IsTimeoutReturnCorrectly)
 
   bool isTimeout = false;
   sChronoLong testChrono = {0x00};
+  tickVal = 0;
 
   fChrono_Init(&tickVal); // It takes 4.294967296 seconds to overflow the tick generator.
 
@@ -1816,6 +3001,7 @@ TEST(GROUP_7, ChronoLong_TimeoutMsWithVeryLongDuration_IsTimeoutReturnCorrectly)
 
   bool isTimeout = false;
   sChronoLong testChrono = {0x00};
+  tickVal = 0;
 
   fChrono_Init(&tickVal); // It takes 4.294967296 seconds to overflow the tick generator.
 
@@ -1941,74 +3127,1124 @@ TEST_GROUP_RUNNER(GROUP_8) {
 /** @} */ //End of TEST_GROUP_8
 #endif
 
-/*
-╔══════════════════════════════════════════════════════════════════════════════════╗
-║                            ##### Private Functions #####                         ║
-╚══════════════════════════════════════════════════════════════════════════════════╝
-*/
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+/** @defgroup TEST_GROUP_9
+ *  @{
+ */
 
 /**
- * @brief Run all tests in test group.
+ * @brief Reference conversions of ticks to microseconds, milliseconds and seconds.
  * 
  */
-static void RunTests(void) {
+#define REF_TICK_TO_US_(tick_) ((uint32_t)(((uint64_t)(tick_) * CHRONO_TICK_TO_NANOSECOND_COEF) / 1000U))
+#define REF_TICK_TO_MS_(tick_) ((uint32_t)(((uint64_t)(tick_) * CHRONO_TICK_TO_NANOSECOND_COEF) / 1000000U))
+#define REF_TICK_TO_S_(tick_)  ((uint32_t)(((uint64_t)(tick_) * CHRONO_TICK_TO_NANOSECOND_COEF) / 1000000000U))
+
+/**
+ * @brief Tick counts that are used to compare division-free conversions with the reference division.
+ * 
+ */
+static const uint32_t conversionTicks[] = {
+  0U, 1U, 6U, 7U, 141U, 142U, 143U, 284U, 142856U, 142857U, 142858U, 285714U,
+  142857141U, 142857142U, 142857143U, 285714284U, 285714285U,
+  0x7FFFFFFFU, 0x80000000U, 0x80000001U, 0xAAAAAAAAU, 0xDEADBEEFU, 0xFFFFFFFEU, 0xFFFFFFFFU
+};
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_9);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_9) {
   
-#if(CHRONO_TEST_STATUS == CHRONO_TESTS_DISABLED)
-  (void)(RunTests);
-#endif
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
-  RUN_TEST_GROUP(GROUP_1);
-#endif
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_9) {
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_2)
-  RUN_TEST_GROUP(GROUP_2);
-#endif
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_3)
-  RUN_TEST_GROUP(GROUP_3);
-#endif
+/**
+ * @brief fChrono_TimeSpanUs(), fChrono_TimeSpanMs() and fChrono_TimeSpanS() return the exact time length of the ticks.
+ * 
+ */
+TEST(GROUP_9, Chrono_TimeSpanIsCalledWithDifferentTicks_ReturnExactTime) {
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_4)
-  RUN_TEST_GROUP(GROUP_4);
-#endif
+  fChrono_Init(&tickVal);
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_5)
-  RUN_TEST_GROUP(GROUP_5);
-#endif
+  for(uint32_t i = 0; i < ArraySize_(conversionTicks); i++) {
+    uint32_t ticks = conversionTicks[i];
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_US_(ticks), fChrono_TimeSpanUs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_MS_(ticks), fChrono_TimeSpanMs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_S_(ticks), fChrono_TimeSpanS(0, ticks));
+  }
+
+  uint32_t ticks = 12345U;
+  for(uint32_t i = 0; i < 100000U; i++) {
+    ticks = (ticks * 1664525U) + 1013904223U;
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_US_(ticks), fChrono_TimeSpanUs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_MS_(ticks), fChrono_TimeSpanMs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_S_(ticks), fChrono_TimeSpanS(0, ticks));
+  }
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_6)
-  RUN_TEST_GROUP(GROUP_6);
-#endif
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_7)
-  RUN_TEST_GROUP(GROUP_7);
-#endif
+/**
+ * @brief fChrono_ElapsedUs(), fChrono_ElapsedMs() and fChrono_ElapsedS() return the exact time length of the ticks.
+ * 
+ */
+TEST(GROUP_9, Chrono_ElapsedIsCalledWithDifferentTicks_ReturnExactTime) {
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_8)
-  RUN_TEST_GROUP(GROUP_8);
-#endif
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  for(uint32_t i = 0; i < ArraySize_(conversionTicks); i++) {
+    tickVal = 0;
+    fChrono_Start(&testChrono);
+    tickVal = conversionTicks[i];
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_US_(tickVal), fChrono_ElapsedUs(&testChrono));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_MS_(tickVal), fChrono_ElapsedMs(&testChrono));
+    TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_S_(tickVal), fChrono_ElapsedS(&testChrono));
+  }
 
 }
 
 /**
- * @brief Unit test one time setup.
+ * @brief fChrono_LeftUs() and fChrono_GetMaxMeasurableTime functions return the exact time length of the ticks.
  * 
  */
-static void OneTimeSetup(void) {
-  
-  pTick = fChrono_GetTickPointer();
+TEST(GROUP_9, Chrono_LeftAndMaxTimeAreCalled_ReturnExactTime) {
+
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_US_(0xFFFFFFFFU), fChrono_GetMaxMeasurableTimeUs());
+  TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_MS_(0xFFFFFFFFU), fChrono_GetMaxMeasurableTimeMs());
+  TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_S_(0xFFFFFFFFU), fChrono_GetMaxMeasurableTimeS());
+
+  tickVal = 0;
+  fChrono_StartTimeoutUs(&testChrono, 1000);
+  tickVal = 1000;
+  TEST_ASSERT_EQUAL_UINT32(REF_TICK_TO_US_((1000U * 1000U) / CHRONO_TICK_TO_NANOSECOND_COEF) - REF_TICK_TO_US_(1000U), fChrono_LeftUs(&testChrono));
+
+}
+
+/**
+ * @brief A block that is polled on every tick runs on time. Its period can be rounded below the interval, and it must still be recorded with zero jitter.
+ * 
+ */
+TEST(GROUP_9, ChronoEx_RunEveryStatsBlockIsOnTime_RecordsRoundedPeriodsWithoutJitter) {
+
+  sChrono blockChrono = {FALSE, 0, 0, 0, FALSE};
+  sChronoRunStats stats = {0};
+  uint32_t runs = 0;
+
+  fChrono_Init(&tickVal);
+
+  for(tickVal = 0; runs < 5U; tickVal++) {
+    RUN_EVERY_STATS_US_OBJ_(block, &blockChrono, 100, &stats)
+    {
+      runs++;
+      RUN_END_;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(5, stats.Count);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.Misses);
+  TEST_ASSERT_EQUAL_UINT32(99, stats.PeriodMin);
+  TEST_ASSERT_EQUAL_UINT32(5, stats.Jitter[0]);
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_9) {
+
+  RUN_TEST_CASE(GROUP_9, Chrono_TimeSpanIsCalledWithDifferentTicks_ReturnExactTime);
+  RUN_TEST_CASE(GROUP_9, Chrono_ElapsedIsCalledWithDifferentTicks_ReturnExactTime);
+  RUN_TEST_CASE(GROUP_9, Chrono_LeftAndMaxTimeAreCalled_ReturnExactTime);
+  RUN_TEST_CASE(GROUP_9, ChronoEx_RunEveryStatsBlockIsOnTime_RecordsRoundedPeriodsWithoutJitter);
+
+}
+
+/** @} */ //End of TEST_GROUP_9
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+/** @defgroup TEST_GROUP_10
+ *  @{
+ */
+
+/**
+ * @brief Reference conversions of ticks of a fractional tick period to nanoseconds.
+ * 
+ */
+#define REF_TICK_TO_NS_(tick_) (((uint64_t)(tick_) * CHRONO_TICK_PERIOD_NUM) / CHRONO_TICK_PERIOD_DEN)
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_10);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_10) {
   
 }
 
 /**
- * @brief Unit test one time teardown.
+ * @brief Unit test teardown.
  * 
  */
-static void OneTimeTearDown(void) {
+TEST_TEAR_DOWN(GROUP_10) {
 
-  fChrono_Init(pTick);
+}
+
+/**
+ * @brief fChrono_Init() accepts a fractional tick period and all time scales are available.
+ * 
+ */
+TEST(GROUP_10, Chrono_InitWithFractionalTickPeriod_AllScalesAreAvailable) {
+
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChrono_Init(&tickVal));
+
+  TEST_ASSERT_TRUE(fChrono_IsTickUsAvailable());
+  TEST_ASSERT_TRUE(fChrono_IsTickMsAvailable());
+  TEST_ASSERT_TRUE(fChrono_IsTickSAvailable());
+  TEST_ASSERT_EQUAL_UINT32(CHRONO_TICK_PERIOD_NUM, fChrono_GetTickPeriodNum());
+  TEST_ASSERT_EQUAL_UINT32(CHRONO_TICK_PERIOD_DEN, fChrono_GetTickPeriodDen());
+  TEST_ASSERT_EQUAL_UINT32(CHRONO_TICK_PERIOD_NUM / CHRONO_TICK_PERIOD_DEN, fChrono_GetTickToNsCoef());
+
+}
+
+/**
+ * @brief fChrono_TimeSpanUs(), fChrono_TimeSpanMs() and fChrono_TimeSpanS() return exact time lengths for a fractional tick period.
+ * 
+ */
+TEST(GROUP_10, Chrono_TimeSpanIsCalledWithFractionalTickPeriod_ReturnExactTime) {
+
+  fChrono_Init(&tickVal);
+
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_TimeSpanUs(0, 167));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChrono_TimeSpanUs(0, 168));
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChrono_TimeSpanMs(0, 168000000U));
+  TEST_ASSERT_EQUAL_UINT32(25U, fChrono_TimeSpanS(0, 0xFFFFFFFFU));
+
+  uint32_t ticks = 12345U;
+  for(uint32_t i = 0; i < 100000U; i++) {
+    ticks = (ticks * 1664525U) + 1013904223U;
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(REF_TICK_TO_NS_(ticks) / 1000U), fChrono_TimeSpanUs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(REF_TICK_TO_NS_(ticks) / 1000000U), fChrono_TimeSpanMs(0, ticks));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(REF_TICK_TO_NS_(ticks) / 1000000000U), fChrono_TimeSpanS(0, ticks));
+  }
+
+}
+
+/**
+ * @brief fChrono_StartTimeoutUs() converts the timeout to ticks with a fractional tick period.
+ * 
+ */
+TEST(GROUP_10, Chrono_TimeoutUsIsStartedWithFractionalTickPeriod_TimesOutAtExactTick) {
+
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  tickVal = 1000;
+  fChrono_StartTimeoutUs(&testChrono, 10);
+
+  tickVal = 1000 + 1679;
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChrono_LeftUs(&testChrono));
+
+  tickVal = 1000 + 1680;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+
+}
+
+/**
+ * @brief Nanosecond functions keep the resolution of a fractional tick period.
+ * 
+ */
+TEST(GROUP_10, Chrono_NsFunctionsAreCalledWithFractionalTickPeriod_ReturnExactTime) {
+
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  TEST_ASSERT_EQUAL_UINT64(REF_TICK_TO_NS_(0xFFFFFFFFU), fChrono_TimeSpanNs(0, 0xFFFFFFFFU));
+  TEST_ASSERT_EQUAL_UINT64(REF_TICK_TO_NS_(2), fChrono_TimeSpanNs(0xFFFFFFFEU, 1));
+
+  tickVal = 500;
+  fChrono_Start(&testChrono);
+  tickVal = 501;
+  TEST_ASSERT_EQUAL_UINT64(5, fChrono_ElapsedNs(&testChrono));
+  TEST_ASSERT_EQUAL_UINT64(1, fChrono_ElapsedTick(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32(0, fChrono_ElapsedUs(&testChrono));
+
+  tickVal = 1000;
+  TEST_ASSERT_EQUAL_UINT64(REF_TICK_TO_NS_(500), fChrono_IntervalNs(&testChrono));
+  tickVal = 1021;
+  TEST_ASSERT_EQUAL_UINT64(21, fChrono_IntervalTick(&testChrono));
+
+  tickVal = 2000;
+  fChrono_StartTimeoutNs(&testChrono, 1000);
+  TEST_ASSERT_EQUAL_UINT64(168, fChrono_LeftTick(&testChrono));
+  TEST_ASSERT_EQUAL_UINT64(REF_TICK_TO_NS_(168), fChrono_LeftNs(&testChrono));
+
+  tickVal = 2000 + 167;
+  TEST_ASSERT_EQUAL_UINT64(REF_TICK_TO_NS_(1), fChrono_LeftNs(&testChrono));
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&testChrono));
+
+  tickVal = 2000 + 168;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+  TEST_ASSERT_EQUAL_UINT64(0, fChrono_LeftNs(&testChrono));
+
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_10) {
+
+  RUN_TEST_CASE(GROUP_10, Chrono_InitWithFractionalTickPeriod_AllScalesAreAvailable);
+  RUN_TEST_CASE(GROUP_10, Chrono_TimeSpanIsCalledWithFractionalTickPeriod_ReturnExactTime);
+  RUN_TEST_CASE(GROUP_10, Chrono_TimeoutUsIsStartedWithFractionalTickPeriod_TimesOutAtExactTick);
+  RUN_TEST_CASE(GROUP_10, Chrono_NsFunctionsAreCalledWithFractionalTickPeriod_ReturnExactTime);
+
+}
+
+/** @} */ //End of TEST_GROUP_10
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+/** @defgroup TEST_GROUP_11
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_11);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_11) {
   
 }
 
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_11) {
+
+}
+
+/**
+ * @brief Moves the 16-bit tick forward and observes it like the overflow interrupt of the timer does.
+ * 
+ * @param step Number of ticks to move forward. It must be less than one period of the tick generator.
+ * @retval ticks: The number of ticks that the module counts for this step.
+ */
+static uint32_t AdvanceTick(uint32_t step) {
+
+  uint32_t lastTick = tickVal;
+  tickVal = (tickVal + step) & CHRONO_TICK_TOP_VALUE;
+  fChrono_UpdateTimebase();
+
+  return (tickVal >= lastTick) ? (tickVal - lastTick) : (CHRONO_TICK_TOP_VALUE - (lastTick - tickVal));
+}
+
+/**
+ * @brief fChrono_ElapsedUs() and fChrono_ElapsedMs() measure time spans over many overflows of the tick generator.
+ * 
+ */
+TEST(GROUP_11, Chrono_ElapsedIsCalledAfterManyOverflows_ReturnFullSpan) {
+
+  sChrono testChrono;
+  uint64_t ticks = 0;
+
+  tickVal = 0;
+  fChrono_Init(&tickVal);
+  fChrono_Start(&testChrono);
+
+  for(uint32_t i = 0; i < 200U; i++) {
+    ticks += AdvanceTick(0x8000U);
+  }
+  ticks += AdvanceTick(123U);
+
+  TEST_ASSERT_EQUAL_UINT64(ticks, fChrono_GetTick64());
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)ticks, fChrono_ElapsedUs(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)(ticks / 1000U), fChrono_ElapsedMs(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)(ticks / 1000000U), fChrono_ElapsedS(&testChrono));
+
+  fChrono_Stop(&testChrono);
+  AdvanceTick(0x8000U);
+  AdvanceTick(0x8000U);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)ticks, fChrono_ElapsedUs(&testChrono));
+
+}
+
+/**
+ * @brief A timeout longer than one period of the tick generator expires at the right tick.
+ * 
+ */
+TEST(GROUP_11, Chrono_TimeoutMsIsLongerThanTickPeriod_TimesOutAtExactTick) {
+
+  sChrono testChrono;
+  uint32_t ticks = 0;
+
+  tickVal = 0x1234U;
+  fChrono_Init(&tickVal);
+  fChrono_StartTimeoutMs(&testChrono, 1000);
+
+  while(ticks < 1000000U) {
+    TEST_ASSERT_FALSE(fChrono_IsTimeout(&testChrono));
+    TEST_ASSERT_EQUAL_UINT32(1000U - (ticks / 1000U), fChrono_LeftMs(&testChrono));
+    ticks += AdvanceTick(((1000000U - ticks) < 0x4000U) ? (1000000U - ticks) : 0x4000U);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(1000000U, ticks);
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32(0, fChrono_LeftMs(&testChrono));
+
+}
+
+/**
+ * @brief Deadline and compact objects with a timeout longer than one period of the tick generator expire at the same tick as a chrono object.
+ * 
+ */
+TEST(GROUP_11, Chrono_DeadlineAndCompactAreLongerThanTickPeriod_TimeOutWithChrono) {
+
+  sChrono testChrono;
+  sChronoDeadline testDeadline;
+  sChronoCompact testCompact;
+  uint32_t ticks = 0;
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(uint64_t), fChrono_GetCompactRamUsage());
+
+  tickVal = 0x4321U;
+  fChrono_Init(&tickVal);
+  fChrono_StartTimeoutUs(&testChrono, 300000);
+  fChrono_DeadlineStartUs(&testDeadline, 300000);
+  fChrono_CompactStartUs(&testCompact, 300000);
+
+  while(ticks < 300000U) {
+    TEST_ASSERT_FALSE(fChrono_DeadlineIsTimeout(&testDeadline));
+    TEST_ASSERT_FALSE(fChrono_CompactIsTimeout(&testCompact));
+    TEST_ASSERT_EQUAL_UINT32(fChrono_LeftUs(&testChrono), fChrono_DeadlineLeftUs(&testDeadline));
+    TEST_ASSERT_EQUAL_UINT32(fChrono_LeftUs(&testChrono), fChrono_CompactLeftUs(&testCompact));
+    ticks += AdvanceTick(((300000U - ticks) < 0x7000U) ? (300000U - ticks) : 0x7000U);
+  }
+
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+  TEST_ASSERT_TRUE(fChrono_DeadlineIsTimeout(&testDeadline));
+  TEST_ASSERT_TRUE(fChrono_CompactIsTimeout(&testCompact));
+
+}
+
+/**
+ * @brief fChrono_IntervalUs() measures intervals longer than one period of the tick generator.
+ * 
+ */
+TEST(GROUP_11, Chrono_IntervalUsIsLongerThanTickPeriod_ReturnInterval) {
+
+  sChrono testChrono;
+  uint32_t ticks = 0;
+
+  tickVal = 0xFF00U;
+  fChrono_Init(&tickVal);
+  fChrono_Start(&testChrono);
+
+  ticks += AdvanceTick(0xC000U);
+  ticks += AdvanceTick(0xC000U);
+  ticks += AdvanceTick(0xC000U);
+  TEST_ASSERT_EQUAL_UINT32(ticks, fChrono_IntervalUs(&testChrono));
+
+  ticks = AdvanceTick(0x0100U);
+  TEST_ASSERT_EQUAL_UINT32(ticks, fChrono_IntervalUs(&testChrono));
+
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_11) {
+
+  RUN_TEST_CASE(GROUP_11, Chrono_ElapsedIsCalledAfterManyOverflows_ReturnFullSpan);
+  RUN_TEST_CASE(GROUP_11, Chrono_TimeoutMsIsLongerThanTickPeriod_TimesOutAtExactTick);
+  RUN_TEST_CASE(GROUP_11, Chrono_IntervalUsIsLongerThanTickPeriod_ReturnInterval);
+  RUN_TEST_CASE(GROUP_11, Chrono_DeadlineAndCompactAreLongerThanTickPeriod_TimeOutWithChrono);
+
+}
+
+/** @} */ //End of TEST_GROUP_11
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+/** @defgroup TEST_GROUP_12
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_12);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_12) {
+  
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_12) {
+
+}
+
+/**
+ * @brief Floating point time types are converted from ticks with the ratio of the tick period.
+ * 
+ */
+TEST(GROUP_12, Chrono_TimeSpanIsCalledWithFloatingPointTime_ReturnExactTime) {
+
+  fChrono_Init(&tickVal);
+
+  TEST_ASSERT_FLOAT_WITHIN(0.00001f, 15.0f, fChrono_TimeSpanUs(0, 1000));
+  TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.015f, fChrono_TimeSpanUs(0, 1));
+  TEST_ASSERT_FLOAT_WITHIN(1e-12, 0.015, fChrono_TimeSpanMs(0, 1000));
+  TEST_ASSERT_FLOAT_WITHIN(0.000001f, 3.0f, fChrono_TimeSpanS(0, 200000000U));
+
+}
+
+/**
+ * @brief Floating point timeouts that are an exact number of ticks are not truncated to the tick before.
+ * 
+ * @note With a 15ns tick, the ratio of microseconds to ticks (66.67) has no exact binary value. Without rounding the ratio up,
+ *       a timeout of 15us would be 999 ticks instead of 1000.
+ * 
+ */
+TEST(GROUP_12, Chrono_TimeoutIsStartedWithFloatingPointTime_TimesOutAtExactTick) {
+
+  sChrono testChrono;
+  fChrono_Init(&tickVal);
+
+  tickVal = 1000;
+  fChrono_StartTimeoutUs(&testChrono, 15.0f);
+
+  tickVal = 1000 + 999;
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&testChrono));
+
+  tickVal = 1000 + 1000;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&testChrono));
+
+  for(uint32_t time = 1; time <= 1000U; time++) {
+    fChrono_StartTimeoutUs(&testChrono, (timeUs_t)(15U * time));
+    TEST_ASSERT_EQUAL_UINT64(1000U * time, fChrono_LeftTick(&testChrono));
+    fChrono_StartTimeoutMs(&testChrono, (timeMs_t)time);
+    TEST_ASSERT_EQUAL_UINT64((1000000U * time) / 15U, fChrono_LeftTick(&testChrono));
+  }
+
+  /* 200000000 ticks is beyond the 24-bit precision of float, so the timeout may be a few steps of float longer, but never shorter. */
+  fChrono_StartTimeoutS(&testChrono, 3.0f);
+  TEST_ASSERT_GREATER_OR_EQUAL(200000000U, fChrono_LeftTick(&testChrono));
+  TEST_ASSERT_LESS_OR_EQUAL(200000064U, fChrono_LeftTick(&testChrono));
+
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_12) {
+
+  RUN_TEST_CASE(GROUP_12, Chrono_TimeSpanIsCalledWithFloatingPointTime_ReturnExactTime);
+  RUN_TEST_CASE(GROUP_12, Chrono_TimeoutIsStartedWithFloatingPointTime_TimesOutAtExactTick);
+
+}
+
+/** @} */ //End of TEST_GROUP_12
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+/** @defgroup TEST_GROUP_13
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_13);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_13) {
+  
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_13) {
+
+}
+
+/**
+ * @brief With TICK_TYPE_HOST, fChrono_Init() has no parameter and the tick pointer is the host tick function.
+ * 
+ */
+TEST(GROUP_13, Chrono_InitIsCalledWithHostTick_ReturnHostTickFunction) {
+
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_OK, fChrono_Init());
+  TEST_ASSERT_TRUE(fChrono_GetTickPointer() == fChrono_GetHostTick);
+  TEST_ASSERT_EQUAL_UINT8(TICK_TYPE_HOST, fChrono_GetDefaultClock()->_tickType);
+
+}
+
+/**
+ * @brief A tick delay longer than the tick range of the clock is split into parts and waits for all of its ticks.
+ * 
+ */
+TEST(GROUP_13, ChronoClock_DelayTicksIsLongerThanTickRange_WaitsAllTicks) {
+
+  sChrono testChrono;
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(fChrono_GetHostTick, 0xFFFFFU, 1U, 1U, TICK_COUNTERMODE_UP);
+
+  fChrono_Init();
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+  /* The range of the clock is about 1 ms, so the 5 ms delay has 10 parts. */
+  fChrono_Start(&testChrono);
+  fChronoClock_DelayTicks(&clock, 5000000U);
+  TEST_ASSERT_GREATER_OR_EQUAL(5000U, fChrono_ElapsedUs(&testChrono));
+  TEST_ASSERT_LESS_OR_EQUAL(1000000U, fChrono_ElapsedUs(&testChrono));
+
+  fChrono_Start(&testChrono);
+  fChrono_DelayTicks(2000000U);
+  TEST_ASSERT_GREATER_OR_EQUAL(2000U, fChrono_ElapsedUs(&testChrono));
+}
+
+/**
+ * @brief The default clock and a user clock on the same host counter measure the same delay.
+ * 
+ * @note The upper bounds only catch a wrong scale. The host may preempt the test for a long time.
+ * 
+ */
+TEST(GROUP_13, Chrono_DelayIsMeasuredWithHostTick_ElapsedFollowsHostClock) {
+
+  sChrono testChrono;
+  sChrono clockChrono;
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(fChrono_GetHostTick, 0xFFFFFFFFU, 1U, 1U, TICK_COUNTERMODE_UP);
+
+  fChrono_Init();
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+  fChrono_Start(&testChrono);
+  fChronoClock_Start(&clock, &clockChrono);
+  fChrono_DelayUs(2000U);
+
+  TEST_ASSERT_GREATER_OR_EQUAL(2000U, fChrono_ElapsedUs(&testChrono));
+  TEST_ASSERT_LESS_OR_EQUAL(1000000U, fChrono_ElapsedUs(&testChrono));
+  TEST_ASSERT_GREATER_OR_EQUAL(2000000U, fChronoClock_ElapsedTick(&clock, &clockChrono));
+  TEST_ASSERT_LESS_OR_EQUAL(1000000000U, fChronoClock_ElapsedTick(&clock, &clockChrono));
+
+}
+
+/**
+ * @brief A user clock on the host counter with a wrong tick period is calibrated against the default clock, which reads the same counter.
+ * 
+ * @note The measured frequency must be 1 GHz within the reported error.
+ * 
+ */
+TEST(GROUP_13, ChronoClock_CalibrateAgainstHostTick_MeasuresNanosecondCounter) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(fChrono_GetHostTick, 0xFFFFFFFFU, 3U, 1U, TICK_COUNTERMODE_UP);
+  sChronoCalibration calibration;
+
+  fChrono_Init();
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_OK, fChronoClock_Calibrate(&clock, fChrono_GetDefaultClock(), 20000000U, &calibration));
+
+  uint64_t error = ((uint64_t)calibration.ErrorPpm * 1000U) + 1U;
+  TEST_ASSERT_GREATER_OR_EQUAL(1000000000U - error, calibration.FrequencyHz);
+  TEST_ASSERT_LESS_OR_EQUAL(1000000000U + error, calibration.FrequencyHz);
+  TEST_ASSERT_GREATER_OR_EQUAL(20000000U, calibration.ReferenceNs);
+  TEST_ASSERT_UINT64_WITHIN(calibration.ErrorPpm + 1U, 1000000U, fChronoClock_TimeSpanNs(&clock, 0U, 1000000U));
+
+}
+
+/**
+ * @brief With CHRONO_DELAY_SLEEP, a delay on the host sleeps for most of its length, so it uses a small part of its time on the CPU.
+ * 
+ * @note The CPU time bound is loose. The host may preempt the test, but it doesn't add CPU time to the process.
+ * 
+ */
+TEST(GROUP_13, Chrono_DelayIsSleptOnHost_UsesLittleCpuTime) {
+
+  sChrono testChrono;
+  struct timespec cpuStart;
+  struct timespec cpuEnd;
+
+  fChrono_Init();
+  fChrono_DelayMs(1U);
+
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuStart);
+  fChrono_Start(&testChrono);
+  fChrono_DelayMs(20U);
+  uint32_t elapsedUs = fChrono_ElapsedUs(&testChrono);
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuEnd);
+
+  uint64_t cpuNs = (((uint64_t)cpuEnd.tv_sec * 1000000000U) + (uint64_t)cpuEnd.tv_nsec) - (((uint64_t)cpuStart.tv_sec * 1000000000U) + (uint64_t)cpuStart.tv_nsec);
+  TEST_ASSERT_GREATER_OR_EQUAL(20000U, elapsedUs);
+  TEST_ASSERT_LESS_OR_EQUAL(10000000U, cpuNs);
+  TEST_ASSERT_GREATER_OR_EQUAL(1000U, fChrono_GetDelaySpinWindowNs());
+  TEST_ASSERT_LESS_OR_EQUAL(1000000U, fChrono_GetDelaySpinWindowNs());
+
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_13) {
+
+  RUN_TEST_CASE(GROUP_13, Chrono_InitIsCalledWithHostTick_ReturnHostTickFunction);
+  RUN_TEST_CASE(GROUP_13, Chrono_DelayIsMeasuredWithHostTick_ElapsedFollowsHostClock);
+  RUN_TEST_CASE(GROUP_13, ChronoClock_DelayTicksIsLongerThanTickRange_WaitsAllTicks);
+  RUN_TEST_CASE(GROUP_13, ChronoClock_CalibrateAgainstHostTick_MeasuresNanosecondCounter);
+  RUN_TEST_CASE(GROUP_13, Chrono_DelayIsSleptOnHost_UsesLittleCpuTime);
+
+}
+
+/** @} */ //End of TEST_GROUP_13
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+/** @defgroup TEST_GROUP_14
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_14);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_14) {
+  
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_14) {
+
+}
+
+/**
+ * @brief Number of calls to the sleep function of the delay test and the time length of the last request.
+ * 
+ */
+static uint32_t sleepCalls;
+static uint64_t sleepRequestNs;
+
+/**
+ * @brief Sleep function of the delay test. It advances the tick by the requested time plus 200 us of wake-up latency.
+ * 
+ */
+static void SleepWithLatency(uint64_t sleepNs) {
+  sleepCalls++;
+  sleepRequestNs = sleepNs;
+  tickVal += (uint32_t)(sleepNs / 1000U) + 200U;
+}
+
+/**
+ * @brief A delay sleeps until the time left is within the spin window, and the spin window follows the wake-up latency of the sleep function.
+ * 
+ */
+TEST(GROUP_14, Chrono_DelayWithSleepFunction_SleepsUntilSpinWindowAndTracksLatency) {
+
+  sChrono testChrono;
+
+  tickVal = 1000U;
+  fChrono_Init(&tickVal);
+  fChrono_SetDelaySleep(SleepWithLatency);
+  TEST_ASSERT_EQUAL_UINT32(50000U, fChrono_GetDelaySpinWindowNs());
+
+  /* One sleep ends 200 us late. The window moves halfway to 1.25 x 200 us. */
+  sleepCalls = 0;
+  fChrono_Start(&testChrono);
+  fChrono_DelayMs(10U);
+  TEST_ASSERT_EQUAL_UINT32(1U, sleepCalls);
+  TEST_ASSERT_EQUAL_UINT64(9950000U, sleepRequestNs);
+  TEST_ASSERT_EQUAL_UINT32(10150U, fChrono_ElapsedUs(&testChrono));
+  TEST_ASSERT_EQUAL_UINT32(150000U, fChrono_GetDelaySpinWindowNs());
+
+  fChrono_DelayUs(10000U);
+  TEST_ASSERT_EQUAL_UINT32(2U, sleepCalls);
+  TEST_ASSERT_EQUAL_UINT64(9850000U, sleepRequestNs);
+  TEST_ASSERT_EQUAL_UINT32(200000U, fChrono_GetDelaySpinWindowNs());
+
+  fChrono_SetDelaySleep(NULL);
+  TEST_ASSERT_EQUAL_UINT32(50000U, fChrono_GetDelaySpinWindowNs());
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_14) {
+
+  RUN_TEST_CASE(GROUP_14, Chrono_DelayWithSleepFunction_SleepsUntilSpinWindowAndTracksLatency);
+
+}
+
+/** @} */ //End of TEST_GROUP_14
+#endif
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_15) || (CHRONO_TEST_GROUP == TEST_GROUP_16))
+/**
+ * @brief Tick value of the clock in the overhead and spin hint tests.
+ * 
+ */
+static uint32_t readTickVal;
+
+/**
+ * @brief Returns the tick value of the clock in the overhead and spin hint tests. Each read advances the tick by one, so the cost of a function is its number of tick reads.
+ * 
+ */
+static tick_t GetTickPerRead(void) {
+  return readTickVal++;
+}
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+/** @defgroup TEST_GROUP_15
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_15);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_15) {
+  
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_15) {
+
+}
+
+/**
+ * @brief The init functions measure the fixed cost of the delay and elapsed functions, and these functions subtract it.
+ * 
+ */
+TEST(GROUP_15, ChronoClock_OverheadIsMeasuredAtInit_DelayAndElapsedSubtractIt) {
+
+  sChrono testChrono;
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetTickPerRead, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+
+  /* The tick of the default clock doesn't move, so there is no overhead. */
+  tickVal = 0;
+  fChrono_Init(&tickVal);
+  TEST_ASSERT_EQUAL_UINT64(0U, fChrono_GetDelayOverheadTick());
+  TEST_ASSERT_EQUAL_UINT64(0U, fChrono_GetElapsedOverheadTick());
+
+  /* Start and elapsed read the tick once each. A delay of zero reads it twice and is bracketed by two reads. */
+  readTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+  TEST_ASSERT_EQUAL_UINT64(1U, fChronoClock_GetElapsedOverheadTick(&clock));
+  TEST_ASSERT_EQUAL_UINT64(2U, fChronoClock_GetDelayOverheadTick(&clock));
+
+  fChronoClock_Start(&clock, &testChrono);
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoClock_ElapsedTick(&clock, &testChrono));
+
+  /* A delay of 10 ticks waits for 8 ticks after its start tick. */
+  readTickVal = 100U;
+  fChronoClock_DelayUs(&clock, 10U);
+  TEST_ASSERT_EQUAL_UINT32(109U, readTickVal);
+
+  /* A delay shorter than the overhead returns right away. */
+  readTickVal = 100U;
+  fChronoClock_DelayUs(&clock, 1U);
+  TEST_ASSERT_EQUAL_UINT32(102U, readTickVal);
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_15) {
+
+  RUN_TEST_CASE(GROUP_15, ChronoClock_OverheadIsMeasuredAtInit_DelayAndElapsedSubtractIt);
+
+}
+
+/** @} */ //End of TEST_GROUP_15
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_16)
+/** @defgroup TEST_GROUP_16
+ *  @{
+ */
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_16);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_16) {
+  
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_16) {
+
+}
+
+/**
+ * @brief Number of spin hints executed by the busy-wait loops.
+ * 
+ */
+static uint32_t spinHintCalls;
+
+/**
+ * @brief Spin hint of test group 16. It only counts its calls.
+ * 
+ */
+void ChronoTest_SpinHint(void) {
+  spinHintCalls++;
+}
+
+/**
+ * @brief The busy-wait loops execute the spin hint between two tick reads, and the number of hints doubles up to CHRONO_SPIN_BACKOFF_MAX.
+ * 
+ */
+TEST(GROUP_16, ChronoClock_BusyWaitWithSpinHint_BacksOffBetweenTickReads) {
+
+  sChronoClock clock;
+  sChronoClockConfig config = TestClockConfig(GetTickPerRead, 0xFFFFFFFFU, 1000U, 1U, TICK_COUNTERMODE_UP);
+  bool_t isTimeout = FALSE;
+  uint32_t loops = 0;
+
+  readTickVal = 0;
+  TEST_ASSERT_EQUAL(CHRONO_OK, fChronoClock_Init(&clock, &config));
+
+  /* The delay reads the tick 11 times. Its loop reads it 10 times, with 1, 2, 4, 8, 8, 8, 8, 8 and 8 hints in between. */
+  spinHintCalls = 0;
+  readTickVal = 100U;
+  fChronoClock_DelayUs(&clock, 10U);
+  TEST_ASSERT_EQUAL_UINT32(111U, readTickVal);
+  TEST_ASSERT_EQUAL_UINT32(55U, spinHintCalls);
+
+  /* Each check of the condition moves the default clock by one tick, so the wait checks it 10 times and backs off 9 times in between. */
+  spinHintCalls = 0;
+  tickVal = 1000U;
+  fChrono_Init(&tickVal);
+  WAIT_FOR_WITH_TIMEOUT_US_(waitTest, (loops++, tickVal++, FALSE), 10U, isTimeout);
+  TEST_ASSERT_TRUE(isTimeout);
+  TEST_ASSERT_EQUAL_UINT32(10U, loops);
+  TEST_ASSERT_EQUAL_UINT32(55U, spinHintCalls);
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_16) {
+
+  RUN_TEST_CASE(GROUP_16, ChronoClock_BusyWaitWithSpinHint_BacksOffBetweenTickReads);
+
+}
+
+/** @} */ //End of TEST_GROUP_16
+#endif
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Run all tests in test group.
+ * 
+ */
+static void RunTests(void) {
+  
+#if(CHRONO_TEST_STATUS == CHRONO_TESTS_DISABLED)
+  (void)(RunTests);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
+  RUN_TEST_GROUP(GROUP_1);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_2)
+  RUN_TEST_GROUP(GROUP_2);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_3)
+  RUN_TEST_GROUP(GROUP_3);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_4)
+  RUN_TEST_GROUP(GROUP_4);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_5)
+  RUN_TEST_GROUP(GROUP_5);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_6)
+  RUN_TEST_GROUP(GROUP_6);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_7)
+  RUN_TEST_GROUP(GROUP_7);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_8)
+  RUN_TEST_GROUP(GROUP_8);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+  RUN_TEST_GROUP(GROUP_9);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+  RUN_TEST_GROUP(GROUP_10);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+  RUN_TEST_GROUP(GROUP_11);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+  RUN_TEST_GROUP(GROUP_12);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+  RUN_TEST_GROUP(GROUP_13);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+  RUN_TEST_GROUP(GROUP_14);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+  RUN_TEST_GROUP(GROUP_15);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_16)
+  RUN_TEST_GROUP(GROUP_16);
+#endif
+
+}
+
+/**
+ * @brief Unit test one time setup.
+ * 
+ */
+static void OneTimeSetup(void) {
+  
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
+  pTick = fChrono_GetTickPointer();
+#endif
+  
+}
+
+/**
+ * @brief Unit test one time teardown.
+ * 
+ */
+static void OneTimeTearDown(void) {
+
+#if (CHRONO_TICK_TYPE != TICK_TYPE_HOST)
+  fChrono_Init(pTick);
+#else
+  fChrono_Init();
+#endif
+  
+}
+
+#if((CHRONO_TEST_GROUP == TEST_GROUP_1) || (CHRONO_TEST_GROUP == TEST_GROUP_13) || (CHRONO_TEST_GROUP == TEST_GROUP_15) || (CHRONO_TEST_GROUP == TEST_GROUP_16))
+/**
+ * @brief Returns the config of a clock that is read with a tick function.
+ * 
+ * @param getTick Function that returns the tick value
+ * @param top Tick top value
+ * @param periodNum Numerator of the tick period in nanoseconds
+ * @param periodDen Denominator of the tick period in nanoseconds
+ * @param counterMode TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN
+ * @return sChronoClockConfig 
+ */
+static sChronoClockConfig TestClockConfig(fpTick_t getTick, tick_t top, uint32_t periodNum, uint32_t periodDen, uint8_t counterMode) {
+
+  sChronoClockConfig config = {
+    .TickValue = NULL,
+    .GetTickValue = getTick,
+    .TickTopValue = top,
+    .TickPeriodNum = periodNum,
+    .TickPeriodDen = periodDen,
+    .CounterMode = counterMode
+  };
+
+  return config;
+}
+#endif
+
 /************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
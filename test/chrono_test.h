@@ -34,6 +34,7 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
 int fChrono_UnitTests_Run(int argc, const char* argv[]);
+int fChrono_CppUnitTests_Run(int argc, const char* argv[]);
 
 /* Exported variables --------------------------------------------------------*/
 
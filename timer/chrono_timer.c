@@ -0,0 +1,261 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_timer.c
+  * @brief          : ChronoTimer module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The ChronoTimer module provides software timers with callbacks. Instead of polling a chrono object, the application says
+  "call f(context) in 20 ms" or "every 5 ms", and one dispatcher calls the callbacks when the timers expire.
+  The timers are entries of a ChronoSched heap that the module owns (see chrono_sched.c), so they follow its timing rules.
+  This module adds a global dispatcher that can run in an interrupt, the restart of a timer, and callbacks that get the timer itself.
+
+  - Initialize the chrono module and the clock that drives the timers (fChrono_GetDefaultClock() returns the default clock).
+    Then initialize the module with fChronoTimer_Init().
+  - Create a variable of type sChronoTimer for each timer and start it with fChronoTimer_Start(). The timer expires after "delayTick" ticks,
+    and then every "periodTick" ticks. A zero period makes it a one-shot timer. At most CHRONO_TIMER_MAX_TIMERS timers are active at a time.
+  - fChronoTimer_Stop() stops the timer. fChronoTimer_Restart() starts it again with its last delay and period, e.g., to kick a watchdog timer.
+  - Call fChronoTimer_Process() in the main loop, or in a periodic tick interrupt. It calls the callbacks of the expired timers.
+    If it is called from an interrupt, define CHRONO_TIMER_CRITICAL_SECTION_ENTER_ and CHRONO_TIMER_CRITICAL_SECTION_EXIT_ in chrono_timer_config.h.
+    Each critical section covers one heap operation, and the callbacks are called outside of it.
+  - fChronoTimer_NextDeadlineTicks() returns the ticks until the next timer expires, so the main loop can sleep until then.
+  - Callbacks may start, restart and stop any timer, including their own.
+
+  @code
+  static sChronoTimer blinkTimer;
+  static sChronoTimer timeoutTimer;
+
+  static void Blink(sChronoTimer * const timer, void *context) {
+    //Toggle the LED
+    //...
+  }
+
+  static void Timeout(sChronoTimer * const timer, void *context) {
+    //Handle the timeout of the request in context
+    //...
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    fChronoTimer_Init(fChrono_GetDefaultClock());
+
+    //Blink every 500 ms (1 us tick)
+    fChronoTimer_Start(&blinkTimer, 500000, 500000, Blink, NULL);
+    //Call Timeout() once in 20 ms
+    fChronoTimer_Start(&timeoutTimer, 20000, 0, Timeout, &request);
+
+    while(1) {
+      fChronoTimer_Process();
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_timer.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Define assert macros.
+ *
+ */
+#ifdef CHRONO_USE_FULL_ASSERT
+  #define ASSERT_(condition_) if(!(condition_)) {return;}
+  #define ASSERT_RETURN_(condition_, return_) if(!(condition_)) {return (return_);}
+#else
+  #define ASSERT_(condition_)
+  #define ASSERT_RETURN_(condition_, return_)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief Heap array of the active timers.
+ *
+ */
+static sChronoSchedEntry *_timerHeap[CHRONO_TIMER_MAX_TIMERS];
+
+/**
+ * @brief Scheduler of the active timers.
+ *
+ */
+static sChronoSched _timerSched = {0};
+
+/* Private function prototypes -----------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the module. All timers are stopped.
+ *
+ * @note Timers that were active before this call are dropped and must be zero-initialized again before they are started.
+ *
+ * @param clock Pointer to the clock that drives the timers. It must be initialized.
+ * @retval chrono_res_t: Returns CHRONO_OK if initialization is successful, otherwise returns error.
+ */
+chrono_res_t fChronoTimer_Init(sChronoClock const * const clock) {
+
+  if((clock == NULL) || (!clock->_init)) {
+    return CHRONO_TIMER_ERROR_CLOCK;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+  (void)fChronoSched_Init(&_timerSched, clock, _timerHeap, CHRONO_TIMER_MAX_TIMERS);
+  CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+
+  return CHRONO_OK;
+}
+
+/**
+ * @brief Starts the timer. If the timer is active, it is started again with the new times.
+ *
+ * @param timer Pointer to the timer object
+ * @param delayTick Number of ticks until the timer expires for the first time
+ * @param periodTick Number of ticks between the next expiries of the timer, or zero for a one-shot timer
+ * @param callback Function that is called when the timer expires
+ * @param context Argument of the callback
+ * @retval isActive: FALSE if CHRONO_TIMER_MAX_TIMERS timers are already active
+ */
+bool_t fChronoTimer_Start(sChronoTimer * const timer, uint64_t delayTick, uint64_t periodTick, fpChronoTimerCallback_t callback, void *context) {
+
+  ASSERT_RETURN_(_timerSched._clock != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_RETURN_(timer != NULL, FALSE);              /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+  timer->_delay = delayTick;
+  timer->_period = periodTick;
+  timer->_callback = callback;
+  timer->_context = context;
+  bool_t isActive = fChronoSched_Start(&_timerSched, &timer->_entry, delayTick, periodTick, NULL, NULL);
+  CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+
+  return isActive;
+}
+
+/**
+ * @brief Starts the timer again with the delay, period and callback of its last start.
+ *
+ * @param timer Pointer to the timer object. It must have been started before.
+ * @retval isActive: FALSE if CHRONO_TIMER_MAX_TIMERS timers are already active
+ */
+bool_t fChronoTimer_Restart(sChronoTimer * const timer) {
+
+  ASSERT_RETURN_(timer != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fChronoTimer_Start(timer, timer->_delay, timer->_period, timer->_callback, timer->_context);
+}
+
+/**
+ * @brief Stops the timer. Stopping a timer that is not active has no effect.
+ *
+ * @param timer Pointer to the timer object
+ */
+void fChronoTimer_Stop(sChronoTimer * const timer) {
+
+  ASSERT_(timer != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+  fChronoSched_Stop(&_timerSched, &timer->_entry);
+  CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+}
+
+/**
+ * @brief Returns TRUE if the timer is active.
+ *
+ * @param timer Pointer to the timer object
+ * @retval isActive: TRUE if the timer is active
+ */
+bool_t fChronoTimer_IsActive(sChronoTimer const * const timer) {
+
+  ASSERT_RETURN_(timer != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fChronoSched_IsScheduled(&timer->_entry);
+}
+
+/**
+ * @brief Calls the callbacks of the expired timers, in the same order and with the same rescheduling as fChronoSched_Run().
+ *
+ * @note The critical section is left around each callback.
+ *
+ * @retval count: Number of callbacks that were called
+ */
+uint32_t fChronoTimer_Process(void) {
+
+  uint32_t count = 0U;
+
+  ASSERT_RETURN_(_timerSched._clock != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+  sChronoSchedEntry *entry = fChronoSched_RunNext(&_timerSched);
+
+  while(entry != NULL) {
+    /* The entry is the first field of the timer. */
+    sChronoTimer *timer = (sChronoTimer*)entry;
+    fpChronoTimerCallback_t callback = timer->_callback;
+    void *context = timer->_context;
+    CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+
+    if(callback != NULL) {
+      callback(timer, context);
+    }
+    count++;
+
+    CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+    entry = fChronoSched_RunNext(&_timerSched);
+  }
+  CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+
+  return count;
+}
+
+/**
+ * @brief Returns the number of ticks until the next timer expires.
+ *
+ * @retval ticks: Ticks until the next deadline, or CHRONO_TIMER_NO_DEADLINE if no timer is active
+ */
+uint64_t fChronoTimer_NextDeadlineTicks(void) {
+
+  ASSERT_RETURN_(_timerSched._clock != NULL, CHRONO_TIMER_NO_DEADLINE); /* MISRA 2012 Rule 15.5 deviation */
+
+  CHRONO_TIMER_CRITICAL_SECTION_ENTER_;
+  uint64_t ticks = fChronoSched_NextDeadlineTicks(&_timerSched);
+  CHRONO_TIMER_CRITICAL_SECTION_EXIT_;
+
+  return ticks;
+}
+
+/**
+ * @brief Returns the number of active timers.
+ *
+ * @retval count: Number of active timers
+ */
+uint32_t fChronoTimer_GetCount(void) {
+
+  return _timerSched._count;
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_timer.h
+  * @brief          : ChronoTimer module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_timer.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_TIMER_H
+#define CHRONO_TIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "..\chrono.h"
+#include "..\sched\chrono_sched.h"
+#include "chrono_timer_config.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Result value of fChronoTimer_Init() in addition to CHRONO_OK.
+ *
+ */
+#define CHRONO_TIMER_ERROR_CLOCK      (40U)
+
+/**
+ * @brief Returned by fChronoTimer_NextDeadlineTicks() when no timer is active.
+ *
+ */
+#define CHRONO_TIMER_NO_DEADLINE      (CHRONO_SCHED_NO_DEADLINE)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+struct sChronoTimer_;
+
+/**
+  * @brief Pointer to the function that is called when a timer expires.
+  *
+  */
+typedef void(*fpChronoTimerCallback_t)(struct sChronoTimer_ * const timer, void *context);
+
+/**
+  * @brief Definition of the software timer object.
+  *
+  * @note An active timer is an entry of the ChronoSched heap of the module, so the timer must stay valid while it is active.
+  *       A timer must be zero-initialized (e.g., static or "= {0}") before it is started for the first time.
+  *
+  */
+typedef struct sChronoTimer_ {
+
+  sChronoSchedEntry _entry;           /*!< Entry of the timer in the heap. It must be the first field. This parameter is private. */
+
+  uint64_t _delay;                    /*!< Delay of the last start in ticks. fChronoTimer_Restart() uses it. This parameter is private. */
+
+  uint64_t _period;                   /*!< Period of the last start in ticks. fChronoTimer_Restart() uses it. This parameter is private. */
+
+  fpChronoTimerCallback_t _callback;  /*!< Function that is called when the timer expires. This parameter is private. */
+
+  void *_context;                     /*!< Argument of the callback. This parameter is private. */
+}sChronoTimer;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+chrono_res_t fChronoTimer_Init(sChronoClock const * const clock);
+bool_t fChronoTimer_Start(sChronoTimer * const timer, uint64_t delayTick, uint64_t periodTick, fpChronoTimerCallback_t callback, void *context);
+bool_t fChronoTimer_Restart(sChronoTimer * const timer);
+void fChronoTimer_Stop(sChronoTimer * const timer);
+bool_t fChronoTimer_IsActive(sChronoTimer const * const timer);
+uint32_t fChronoTimer_Process(void);
+uint64_t fChronoTimer_NextDeadlineTicks(void);
+uint32_t fChronoTimer_GetCount(void);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_TIMER_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_timer_config.h
+  * @brief          : ChronoTimer module configuration file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_TIMER_CONFIG_H
+#define CHRONO_TIMER_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+  * @brief Largest number of timers that can be active at the same time. It is the size of the heap of the module.
+  *
+  */
+#ifndef CHRONO_TIMER_MAX_TIMERS
+#define CHRONO_TIMER_MAX_TIMERS       (32U)
+#endif
+
+/**
+  * @brief Critical section of the heap of active timers.
+  *
+  * @note If fChronoTimer_Process() is called from a tick interrupt while the application starts and stops timers in the main loop,
+  *       define these macros to disable and enable that interrupt (e.g., __disable_irq() and __enable_irq() on Cortex-M).
+  *       A critical section is one heap operation, which takes O(log N) time. Callbacks are called outside the critical section.
+  */
+#ifndef CHRONO_TIMER_CRITICAL_SECTION_ENTER_
+#define CHRONO_TIMER_CRITICAL_SECTION_ENTER_
+#endif
+
+#ifndef CHRONO_TIMER_CRITICAL_SECTION_EXIT_
+#define CHRONO_TIMER_CRITICAL_SECTION_EXIT_
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_TIMER_CONFIG_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
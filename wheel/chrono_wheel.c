@@ -0,0 +1,435 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_wheel.c
+  * @brief          : ChronoWheel module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this module #####
+  ==============================================================================
+  The ChronoWheel module is a hierarchical timing wheel for applications that keep thousands of timeouts at the same time.
+  Polling one sChrono per timeout with fChrono_IsTimeout() costs O(N) in every loop. The wheel sorts the timers into slots by their expiry,
+  so arming, cancelling and re-arming a timer are O(1), and fChronoWheel_Advance() only visits the timers that expire.
+
+  - Initialize the chrono module and the clock that drives the wheel (fChrono_GetDefaultClock() returns the default clock).
+  - Create a variable of type sChronoWheel and initialize it with fChronoWheel_Init(). The resolution is the length of one step
+    of the wheel in ticks of the clock. Timers expire on the first step boundary after their timeout, so they never expire early
+    and expire at most one resolution step late.
+  - Create a variable of type sChronoWheelTimer for each timeout and arm it with fChronoWheel_Arm().
+    Arming an armed timer re-arms it with the new timeout. fChronoWheel_Cancel() disarms it.
+  - Call fChronoWheel_Advance() once per loop. It calls the callbacks of the expired timers and returns their number.
+    Timers armed without a callback are collected instead, and fChronoWheel_GetExpired() returns them one by one.
+  - The wheel reads fChronoClock_GetTick64(), so it works over any number of overflows of the tick generator.
+    fChronoWheel_Advance() visits every step since its last call while timers are armed, so call it at least once per few resolution steps.
+  - The module is not re-entrant. Arm, cancel and advance a wheel from one context. Callbacks may arm and cancel timers of the same wheel.
+
+  The wheel has CHRONO_WHEEL_LEVELS levels of 2^CHRONO_WHEEL_SLOT_BITS slots (see chrono_wheel_config.h). A timer is put in the level
+  whose slots are just fine enough for its remaining time, and it moves down one level each time the lower level wraps around.
+
+  @code
+  static sChronoWheel wheel;
+  static sChronoWheelTimer connTimer[1000];
+
+  static void ConnTimeout(sChronoWheelTimer * const timer, void *arg) {
+    //Close the connection
+    //...
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    fChronoWheel_Init(&wheel, fChrono_GetDefaultClock(), 1000);  //1000 ticks per step
+
+    fChronoWheel_Arm(&wheel, &connTimer[0], 5000000, ConnTimeout, NULL);
+
+    while(1) {
+      fChronoWheel_Advance(&wheel);
+
+      //On activity of connection 0, re-arm its timer
+      fChronoWheel_Arm(&wheel, &connTimer[0], 5000000, ConnTimeout, NULL);
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_wheel.h"
+
+/* Private define ------------------------------------------------------------*/
+/**
+ * @brief Mask of the slot index in one level.
+ *
+ */
+#define SLOT_MASK_  ((uint64_t)CHRONO_WHEEL_SLOTS - 1U)
+
+/**
+ * @brief The longest time that fits in the wheel without re-inserting (resolution steps).
+ *
+ */
+#define MAX_DELTA_  ((uint64_t)((1ULL << (CHRONO_WHEEL_LEVELS * CHRONO_WHEEL_SLOT_BITS)) - 1U))
+
+#if((CHRONO_WHEEL_LEVELS * CHRONO_WHEEL_SLOT_BITS) > 63U)
+#error "CHRONO_WHEEL_LEVELS * CHRONO_WHEEL_SLOT_BITS must not be greater than 63 in chrono_wheel_config.h file."
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Define assert macros.
+ *
+ */
+#ifdef CHRONO_USE_FULL_ASSERT
+  #define ASSERT_(condition_) if(!(condition_)) {return;}
+  #define ASSERT_RETURN_(condition_, return_) if(!(condition_)) {return (return_);}
+#else
+  #define ASSERT_(condition_)
+  #define ASSERT_RETURN_(condition_, return_)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t GetStep(sChronoWheel const * const me);
+static void Insert(sChronoWheel * const me, sChronoWheelTimer * const timer);
+static void Link(sChronoWheelTimer ** const head, sChronoWheelTimer * const timer);
+static void Unlink(sChronoWheelTimer * const timer);
+static void Cascade(sChronoWheel * const me);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the timing wheel.
+ *
+ * @param me Pointer to the wheel object
+ * @param clock Pointer to the clock that drives the wheel. It must be initialized.
+ * @param resolutionTick Number of clock ticks in one step of the wheel
+ * @retval chrono_res_t: Returns CHRONO_OK if initialization is successful, otherwise returns error.
+ */
+chrono_res_t fChronoWheel_Init(sChronoWheel * const me, sChronoClock const * const clock, uint64_t resolutionTick) {
+
+  if((me == NULL) || (clock == NULL) || (!clock->_init)) {
+    return CHRONO_WHEEL_ERROR_CLOCK;  /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(resolutionTick == 0U) {
+    return CHRONO_WHEEL_ERROR_RESOLUTION; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  for(uint32_t level = 0U; level < CHRONO_WHEEL_LEVELS; level++) {
+    for(uint32_t slot = 0U; slot < CHRONO_WHEEL_SLOTS; slot++) {
+      me->_slot[level][slot] = NULL;
+    }
+  }
+
+  me->_clock = clock;
+  me->_resolution = resolutionTick;
+  me->_startTick = fChronoClock_GetTick64(clock);
+  me->_now = 0U;
+  me->_count = 0U;
+  me->_expired = NULL;
+
+  return CHRONO_OK;
+}
+
+/**
+ * @brief Arms the timer on the wheel. If the timer is already armed, it is re-armed with the new timeout.
+ *
+ * @note The timer expires on the first step of the wheel after "timeoutTick" ticks from now.
+ *
+ * @param me Pointer to the wheel object
+ * @param timer Pointer to the timer object
+ * @param timeoutTick Number of clock ticks until the timer expires
+ * @param callback Function that fChronoWheel_Advance() calls when the timer expires. If NULL, fChronoWheel_GetExpired() returns the timer instead.
+ * @param arg Argument of the callback
+ */
+void fChronoWheel_Arm(sChronoWheel * const me, sChronoWheelTimer * const timer, uint64_t timeoutTick, fpChronoWheelCallback_t callback, void *arg) {
+
+  ASSERT_(me != NULL);    /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_(timer != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  fChronoWheel_Cancel(me, timer);
+
+  uint64_t ticks = (fChronoClock_GetTick64(me->_clock) - me->_startTick) + timeoutTick;
+  uint64_t expiry = (ticks / me->_resolution) + (((ticks % me->_resolution) != 0U) ? 1U : 0U);
+
+  timer->_expiry = (expiry < me->_now) ? me->_now : expiry;
+  timer->_callback = callback;
+  timer->_arg = arg;
+  timer->_isExpired = FALSE;
+
+  Insert(me, timer);
+  me->_count++;
+}
+
+/**
+ * @brief Disarms the timer. It doesn't expire afterwards.
+ *
+ * @note Cancelling a timer that is not armed has no effect. An expired timer that is waiting in fChronoWheel_GetExpired() is removed from there.
+ *
+ * @param me Pointer to the wheel object
+ * @param timer Pointer to the timer object
+ */
+void fChronoWheel_Cancel(sChronoWheel * const me, sChronoWheelTimer * const timer) {
+
+  ASSERT_(me != NULL);    /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_(timer != NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(timer->_pprev != NULL) {
+    if(!timer->_isExpired) {
+      me->_count--;
+    }
+    Unlink(timer);
+  }
+
+  timer->_isExpired = FALSE;
+}
+
+/**
+ * @brief Returns TRUE if the timer is armed and has not expired yet.
+ *
+ * @param timer Pointer to the timer object
+ * @retval isArmed: TRUE if the timer is armed
+ */
+bool_t fChronoWheel_IsArmed(sChronoWheelTimer const * const timer) {
+
+  ASSERT_RETURN_(timer != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  return ((timer->_pprev != NULL) && (!timer->_isExpired));
+}
+
+/**
+ * @brief Returns TRUE if the timer has expired and has not been armed or cancelled since.
+ *
+ * @param timer Pointer to the timer object
+ * @retval isExpired: TRUE if the timer is expired
+ */
+bool_t fChronoWheel_IsExpired(sChronoWheelTimer const * const timer) {
+
+  ASSERT_RETURN_(timer != NULL, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+  return timer->_isExpired;
+}
+
+/**
+ * @brief Moves the wheel to the current time of its clock and expires the timers whose time has come.
+ *
+ * @note Each expired timer is disarmed, then its callback is called. Timers without a callback are collected for fChronoWheel_GetExpired().
+ *       The cost is one step per resolution step since the last call plus the cost of the expired and cascaded timers.
+ *       When no timer is armed, the wheel jumps to the current time at once.
+ *
+ * @param me Pointer to the wheel object
+ * @retval count: Number of timers that expired in this call
+ */
+uint32_t fChronoWheel_Advance(sChronoWheel * const me) {
+
+  uint32_t count = 0U;
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  uint64_t target = GetStep(me);
+
+  while(me->_now <= target) {
+
+    if(me->_count == 0U) {
+      me->_now = target + 1U;
+      break;
+    }
+
+    uint64_t step = me->_now;
+    uint32_t index = (uint32_t)(step & SLOT_MASK_);
+
+    if(index == 0U) {
+      Cascade(me);
+    }
+
+    /* Detach the slot, so the callbacks can arm timers on this slot for the next round. */
+    sChronoWheelTimer *list = me->_slot[0][index];
+    me->_slot[0][index] = NULL;
+    if(list != NULL) {
+      list->_pprev = &list;
+    }
+    me->_now = step + 1U;
+
+    while(list != NULL) {
+      sChronoWheelTimer *timer = list;
+
+      Unlink(timer);
+      me->_count--;
+      timer->_isExpired = TRUE;
+      count++;
+
+      if(timer->_callback != NULL) {
+        timer->_callback(timer, timer->_arg);
+      } else {
+        Link(&me->_expired, timer);
+      }
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief Returns one of the expired timers that have no callback and removes it from the list of expired timers.
+ *
+ * @note The returned timer stays in the expired state (fChronoWheel_IsExpired() returns TRUE) until it is armed or cancelled.
+ *
+ * @param me Pointer to the wheel object
+ * @retval timer: Pointer to the expired timer or NULL if there is no expired timer
+ */
+sChronoWheelTimer* fChronoWheel_GetExpired(sChronoWheel * const me) {
+
+  ASSERT_RETURN_(me != NULL, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  sChronoWheelTimer *timer = me->_expired;
+  if(timer != NULL) {
+    Unlink(timer);
+  }
+
+  return timer;
+}
+
+/**
+ * @brief Returns the number of armed timers.
+ *
+ * @param me Pointer to the wheel object
+ * @retval count: Number of armed timers
+ */
+uint32_t fChronoWheel_GetCount(sChronoWheel const * const me) {
+
+  ASSERT_RETURN_(me != NULL, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return me->_count;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Returns the last resolution step that is complete on the clock of the wheel.
+ *
+ * @param me Pointer to the wheel object
+ * @retval step: Number of complete resolution steps since the initialization of the wheel
+ */
+static uint64_t GetStep(sChronoWheel const * const me) {
+
+  return (fChronoClock_GetTick64(me->_clock) - me->_startTick) / me->_resolution;
+}
+
+/**
+ * @brief Puts the timer in the slot that matches its remaining time.
+ *
+ * @note A timer that is "delta" steps away goes to the lowest level whose range covers delta. In that level its slot is selected by
+ *       the bits of its expiry step, so it is cascaded to the lower level exactly when the lower level reaches its block.
+ *       Timers beyond the range of the wheel are parked in the last level and inserted again when their slot is cascaded.
+ *
+ * @param me Pointer to the wheel object
+ * @param timer Pointer to the timer object
+ */
+static void Insert(sChronoWheel * const me, sChronoWheelTimer * const timer) {
+
+  uint64_t expiry = timer->_expiry;
+  uint64_t delta = expiry - me->_now;
+  uint32_t level = 0U;
+
+  if(delta > MAX_DELTA_) {
+    expiry = me->_now + MAX_DELTA_;
+    delta = MAX_DELTA_;
+  }
+
+  while((level < (CHRONO_WHEEL_LEVELS - 1U)) && ((delta >> ((level + 1U) * CHRONO_WHEEL_SLOT_BITS)) != 0U)) {
+    level++;
+  }
+
+  uint32_t index = (uint32_t)((expiry >> (level * CHRONO_WHEEL_SLOT_BITS)) & SLOT_MASK_);
+
+  Link(&me->_slot[level][index], timer);
+}
+
+/**
+ * @brief Adds the timer to the front of the list.
+ *
+ * @param head Pointer to the head of the list
+ * @param timer Pointer to the timer object
+ */
+static void Link(sChronoWheelTimer ** const head, sChronoWheelTimer * const timer) {
+
+  timer->_next = *head;
+  if(timer->_next != NULL) {
+    timer->_next->_pprev = &timer->_next;
+  }
+  timer->_pprev = head;
+  *head = timer;
+}
+
+/**
+ * @brief Removes the timer from its list.
+ *
+ * @param timer Pointer to the timer object
+ */
+static void Unlink(sChronoWheelTimer * const timer) {
+
+  *timer->_pprev = timer->_next;
+  if(timer->_next != NULL) {
+    timer->_next->_pprev = timer->_pprev;
+  }
+  timer->_next = NULL;
+  timer->_pprev = NULL;
+}
+
+/**
+ * @brief Moves the timers of the upper levels down when the lower levels wrap around.
+ *
+ * @note It is called when the slot index of the first level is zero. Level "n" is cascaded if the indexes of all levels below it are zero.
+ *
+ * @param me Pointer to the wheel object
+ */
+static void Cascade(sChronoWheel * const me) {
+
+  for(uint32_t level = 1U; level < CHRONO_WHEEL_LEVELS; level++) {
+
+    uint32_t index = (uint32_t)((me->_now >> (level * CHRONO_WHEEL_SLOT_BITS)) & SLOT_MASK_);
+
+    sChronoWheelTimer *list = me->_slot[level][index];
+    me->_slot[level][index] = NULL;
+    if(list != NULL) {
+      list->_pprev = &list;
+    }
+
+    while(list != NULL) {
+      sChronoWheelTimer *timer = list;
+
+      Unlink(timer);
+      Insert(me, timer);
+    }
+
+    if(index != 0U) {
+      break;
+    }
+  }
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
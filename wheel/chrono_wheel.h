@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_wheel.h
+  * @brief          : ChronoWheel module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_wheel.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_WHEEL_H
+#define CHRONO_WHEEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "..\chrono.h"
+#include "chrono_wheel_config.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Number of slots in each level of the timing wheel.
+ *
+ */
+#define CHRONO_WHEEL_SLOTS  (1UL << CHRONO_WHEEL_SLOT_BITS)
+
+/**
+ * @brief Result values of fChronoWheel_Init() in addition to CHRONO_OK.
+ *
+ */
+#define CHRONO_WHEEL_ERROR_CLOCK      (10U)
+#define CHRONO_WHEEL_ERROR_RESOLUTION (11U)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+struct sChronoWheelTimer_;
+
+/**
+  * @brief Pointer to the function that is called when a timer expires.
+  *
+  * @note The timer is already disarmed when the callback is called, so the callback can arm it again.
+  *
+  */
+typedef void(*fpChronoWheelCallback_t)(struct sChronoWheelTimer_ * const timer, void *arg);
+
+/**
+  * @brief Definition of the timer object of the timing wheel.
+  *
+  * @note Users create one timer for each timeout (e.g., one per connection) and arm it on a wheel. The timer is linked into the wheel,
+  *       so it must stay valid while it is armed.
+  *       A timer must be zero-initialized (e.g., static or "= {0}") before it is armed for the first time.
+  *
+  */
+typedef struct sChronoWheelTimer_ {
+
+  struct sChronoWheelTimer_ *_next;   /*!< Next timer in the same slot. This parameter is private. */
+
+  struct sChronoWheelTimer_ **_pprev; /*!< Pointer to the link that points to this timer. NULL if the timer is not armed. This parameter is private. */
+
+  uint64_t _expiry;                   /*!< Resolution step of the wheel in which the timer expires. This parameter is private. */
+
+  fpChronoWheelCallback_t _callback;  /*!< Function that is called when the timer expires. This parameter is private. */
+
+  void *_arg;                         /*!< Argument of the callback. This parameter is private. */
+
+  bool_t _isExpired;                  /*!< TRUE if the timer has expired and has not been armed again. This parameter is private. */
+}sChronoWheelTimer;
+
+/**
+  * @brief Definition of the timing wheel object.
+  *
+  */
+typedef struct {
+
+  sChronoClock const *_clock;         /*!< Clock that drives the wheel. */
+
+  uint64_t _resolution;               /*!< Number of clock ticks in one resolution step of the wheel. */
+
+  uint64_t _startTick;                /*!< 64-bit tick of the clock when the wheel was initialized. */
+
+  uint64_t _now;                      /*!< The next resolution step that the wheel processes. All steps before it are processed. */
+
+  uint32_t _count;                    /*!< Number of armed timers. */
+
+  sChronoWheelTimer *_expired;        /*!< Expired timers without callback. fChronoWheel_GetExpired() returns them. */
+
+  sChronoWheelTimer *_slot[CHRONO_WHEEL_LEVELS][CHRONO_WHEEL_SLOTS]; /*!< Lists of armed timers. */
+}sChronoWheel;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+chrono_res_t fChronoWheel_Init(sChronoWheel * const me, sChronoClock const * const clock, uint64_t resolutionTick);
+void fChronoWheel_Arm(sChronoWheel * const me, sChronoWheelTimer * const timer, uint64_t timeoutTick, fpChronoWheelCallback_t callback, void *arg);
+void fChronoWheel_Cancel(sChronoWheel * const me, sChronoWheelTimer * const timer);
+bool_t fChronoWheel_IsArmed(sChronoWheelTimer const * const timer);
+bool_t fChronoWheel_IsExpired(sChronoWheelTimer const * const timer);
+uint32_t fChronoWheel_Advance(sChronoWheel * const me);
+sChronoWheelTimer* fChronoWheel_GetExpired(sChronoWheel * const me);
+uint32_t fChronoWheel_GetCount(sChronoWheel const * const me);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_WHEEL_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_wheel_config.h
+  * @brief          : ChronoWheel module configuration file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_WHEEL_CONFIG_H
+#define CHRONO_WHEEL_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+  * @brief Number of levels of the timing wheel.
+  *
+  * @note Each level covers CHRONO_WHEEL_SLOT_BITS more bits of the timeout, so the wheel holds timeouts up to
+  *       2^(CHRONO_WHEEL_LEVELS * CHRONO_WHEEL_SLOT_BITS) resolution steps without re-inserting them.
+  *       Longer timeouts are allowed. They are parked in the last level and re-inserted until they fit.
+  */
+#ifndef CHRONO_WHEEL_LEVELS
+#define CHRONO_WHEEL_LEVELS     (4U)
+#endif
+
+/**
+  * @brief Number of bits of the slot index in each level. Each level has 2^CHRONO_WHEEL_SLOT_BITS slots.
+  *
+  * @note One slot is one pointer, so a wheel takes CHRONO_WHEEL_LEVELS * 2^CHRONO_WHEEL_SLOT_BITS pointers of RAM.
+  */
+#ifndef CHRONO_WHEEL_SLOT_BITS
+#define CHRONO_WHEEL_SLOT_BITS  (6U)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_WHEEL_CONFIG_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/